@@ -19,6 +19,8 @@
 
 namespace aspino {
 
+volatile bool AbstractSolver::limitReached = false;
+
 ostream& operator<<(ostream& o, lbool l) {
     if(l == l_True) return o << "T";
     if(l == l_False) return o << "F";
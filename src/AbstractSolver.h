@@ -66,6 +66,9 @@ public:
     virtual bool okay() const = 0;
     virtual lbool solve() = 0;
     virtual lbool solve(int n) = 0;
+    
+    // set asynchronously when a resource limit is reached; solvers call interrupt() at the next safe point
+    static volatile bool limitReached;
 };
     
 } // namespace aspino
@@ -18,10 +18,21 @@
 #include "AspSolver.h"
 
 #include <sstream>
+#include <time.h>
+#include <mtl/Sort.h>
+#include <utils/System.h>
 #include "DepGraph.h"
 
 extern Glucose::IntOption option_n;
 
+Glucose::BoolOption option_asp_stats("ASP", "asp-stats", "Print statistics of the unfounded set check at the end of the computation.", false);
+Glucose::EnumOption option_asp_enumeration("ASP", "asp-enumeration", "Enumeration algorithm (assumptions: flip branching literals, without learning clauses from answer sets).", "blocking-clauses|assumptions");
+Glucose::EnumOption option_asp_reasoning("ASP", "asp-reasoning", "Compute brave or cautious consequences on shown atoms (every refinement is printed, the last one is the result).", "none|brave|cautious");
+Glucose::BoolOption option_asp_project("ASP", "asp-project", "Enumerate distinct projections of answer sets on shown atoms.", false);
+Glucose::BoolOption option_asp_simplify("ASP", "asp-simplify", "Simplify the program before the completion (unfolding of atoms defined by a single rule, duplicate rules, shared bodies).", true);
+Glucose::IntOption option_asp_counter_limit("ASP", "asp-counter-limit", "Aggregates whose sequential counter needs more auxiliary atoms are weight constraints, unless recursive.", 1000000, Glucose::IntRange(0, INT32_MAX));
+Glucose::IntOption option_asp_threads("ASP", "asp-threads", "Number of threads enumerating answer sets, when more than one is requested.", 1, Glucose::IntRange(1, INT32_MAX));
+
 namespace aspino {
 
 template<class B>
@@ -67,91 +78,112 @@ ostream& operator<<(ostream& out, const Sum& sum) {
 }
 
 
-AspSolver::AspSolver() {
+AspSolver::AspSolver(AspSolver* master_) : master(master_), id(0), msgs(master_ == NULL ? 1024 : 1) {
     tagCalls = 0;
     nextToPropagate = 0;
     nModels = 0;
+    maxModels = 0;
+    minimizeLevels = 0;
+    // completion and source pointers rely on the clauses of the program
+    preprocessing = false;
+    quiet = true;
+    moreConflictWF = -1;
+    tight = false;
+    falseUnfoundedLevels = 0;
+    wfChecks = wfSets = wfInferences = wfConflicts = 0;
+    wfTime = 0.0;
+    if(master == NULL) master = this;
 }
 
 AspSolver::~AspSolver() {
-    
+    for(int i = 1; i < solvers.size(); i++) delete solvers[i];
 }
 
 void AspSolver::parseNormalRule(Glucose::StreamBuffer& in) {
     trace(asp_pre, 5, "Parsing normal rule...");
     int head = parseInt(in);
-    vec<Literal>* rule = new vec<Literal>();
+    Var headAtom = head == 1 ? var_Undef : getId(head);
     
     int size = parseInt(in);
     int neg = parseInt(in);
     
+    vec<Literal> lits;
+    while(size-- > 0) {
+        int atom = getId(parseInt(in));
+        lits.push(Literal(atom, neg-- > 0 ? Literal::NEG : Literal::POS));
+    }
+    
+    addNormalRule(headAtom, lits);
+}
+
+void AspSolver::addNormalRule(Var headAtom, const vec<Literal>& lits) {
+    int begin = ruleLits.size();
+    
     tagCalls += 3;
-    if(head != 1) {
-        if(supported[getId(head)]) {
+    if(headAtom != var_Undef) {
+        if(supported[headAtom]) {
             trace(asp_pre, 8, "Already supported head. Skip this rule.");
-            delete rule;
-            while(size-- > 0) parseInt(in);
             return;
         }
-        if(value(getId(head)) == l_False) {
+        if(value(headAtom) == l_False) {
             trace(asp_pre, 8, "False head. Replace by contraint.");
-            head = 1;
+            headAtom = var_Undef;
         }
         else {
-            rule->push(Literal(getId(head), Literal::SHEAD));
-            tag[getId(head)] = tagCalls - 2;
+            ruleLits.push(Literal(headAtom, Literal::SHEAD));
+            tag[headAtom] = tagCalls - 2;
         }
     }
     
-    while(size-- > 0) {
-        int atom = getId(parseInt(in));
-        if(neg-- > 0) {
+    for(int i = 0; i < lits.size(); i++) {
+        int atom = lits[i].id;
+        if(lits[i].type == Literal::NEG) {
             if(tag[atom] == tagCalls - 2) {
+                // h :- not h, B. is :- not h, B. (h may have other supports)
                 trace(asp_pre, 8, "Head atom in negative body. Replace by constraint.");
-                rule->operator[](0) = rule->operator[](rule->size()-1);
-                rule->shrink(1);
-                head = 1;
-                continue;
+                ruleLits[begin] = ruleLits.last();
+                ruleLits.pop();
+                headAtom = var_Undef;
             }
             if(tag[atom] == tagCalls - 1) continue;
             if(value(atom) == l_False) continue;
             if(value(atom) == l_True) {
                 trace(asp_pre, 8, "Negative body is false. Skip rule.");
-                delete rule;
-                while(size-- > 0) parseInt(in);
+                ruleLits.shrink(ruleLits.size() - begin);
                 return;
             }
 
-            rule->push(Literal(atom, Literal::NEG));
+            ruleLits.push(Literal(atom, Literal::NEG));
             tag[atom] = tagCalls - 1;
         }
         else {
             if(tag[atom] == tagCalls - 2 || tag[atom] == tagCalls - 1 || value(atom) == l_False) {
                 trace(asp_pre, 8, "Head atom in positive body, or inconsistent body, or false body. Skip rule.");
-                delete rule;
-                while(size-- > 0) parseInt(in);
+                ruleLits.shrink(ruleLits.size() - begin);
                 return;
             }
             if(tag[atom] == tagCalls) continue;
                 
-            rule->push(Literal(atom, Literal::POS));
+            ruleLits.push(Literal(atom, Literal::POS));
             tag[atom] = tagCalls;
         }
     }
     
-    if(head != 1) {
-        if(rule->size() == 1) {
+    if(headAtom != var_Undef) {
+        if(ruleLits.size() - begin == 1) {
             trace(asp_pre, 8, "It is a fact!");
-            supported[rule->operator[](0).id] = true;
-            addClause(rule->operator[](0).toLit());
-            delete rule;
+            supported[ruleLits[begin].id] = true;
+            addClause(ruleLits[begin].toLit());
+            ruleLits.pop();
             return;
         }
-        program.push(rule);
-        for(int i = 0; i < rule->size(); i++) {
-            Literal lit = rule->operator[](i);
-            occ[lit.type][lit.id].push(rule);
-        }
+        ruleBegin.push(begin);
+        ruleSize.push(ruleLits.size() - begin);
+    }
+    else {
+        constraints.push();
+        for(int i = begin; i < ruleLits.size(); i++) constraints.last().push(ruleLits[i].toLit());
+        ruleLits.shrink(ruleLits.size() - begin);
     }
     
 //    vec<Lit> lits;
@@ -173,7 +205,7 @@ void AspSolver::parseChoiceRule(Glucose::StreamBuffer& in) {
         head.push(atom);
     }
     
-    vec<Literal>* rule = new vec<Literal>();
+    int begin = ruleLits.size();
     
     int size = parseInt(in);
     int neg = parseInt(in);
@@ -187,24 +219,24 @@ void AspSolver::parseChoiceRule(Glucose::StreamBuffer& in) {
             if(value(atom) == l_False) continue;
             if(value(atom) == l_True) {
                 trace(asp_pre, 8, "Negative body is false. Skip rule.");
-                delete rule;
+                ruleLits.shrink(ruleLits.size() - begin);
                 while(size-- > 0) parseInt(in);
                 return;
             }
 
-            rule->push(Literal(atom, Literal::NEG));
+            ruleLits.push(Literal(atom, Literal::NEG));
             tag[atom] = tagCalls - 1;
         }
         else {
             if(tag[atom] == tagCalls - 1 || value(atom) == l_False) {
                 trace(asp_pre, 8, "Inconsistent body, or false body. Skip rule.");
-                delete rule;
+                ruleLits.shrink(ruleLits.size() - begin);
                 while(size-- > 0) parseInt(in);
                 return;
             }
             if(tag[atom] == tagCalls) continue;
                 
-            rule->push(Literal(atom, Literal::POS));
+            ruleLits.push(Literal(atom, Literal::POS));
             tag[atom] = tagCalls;
         }
     }
@@ -217,116 +249,290 @@ void AspSolver::parseChoiceRule(Glucose::StreamBuffer& in) {
     }
     head.shrink(head.size() - j);
     if(head.size() == 0) {
-        delete rule;
+        ruleLits.shrink(ruleLits.size() - begin);
         return;
     }
     
+    // the body is followed by the first head, and copied for the others
+    int bodySize = ruleLits.size() - begin;
     for(int i = 0; i < head.size(); i++) {
-        vec<Literal>* r;
-        if(i == head.size()-1) r = rule;
+        if(i == 0) ruleBegin.push(begin);
         else {
-            r = new vec<Literal>();
-            rule->copyTo(*r);
-        }
-        
-        r->push(Literal(head[i], Literal::SHEAD));
-        r->push(Literal(head[i], Literal::DNEG));
-        program.push(r);
-
-        for(int j = 0; j < r->size(); j++) {
-            Literal lit = r->operator[](j);
-            occ[lit.type][lit.id].push(r);
+            ruleBegin.push(ruleLits.size());
+            for(int j = 0; j < bodySize; j++) {
+                Literal lit = ruleLits[begin + j];
+                ruleLits.push(lit);
+            }
         }
+        ruleLits.push(Literal(head[i], Literal::SHEAD));
+        ruleLits.push(Literal(head[i], Literal::DNEG));
+        ruleSize.push(bodySize + 2);
     }
 }
 
 void AspSolver::parseCountRule(Glucose::StreamBuffer& in) {
     trace(asp_pre, 5, "Parsing count rule...");
-    Sum* sum = new Sum();
-    sum->head = parseInt(in);
-    assert(sum->head != 1);
+    int head = parseInt(in);
+    Var headAtom = head == 1 ? var_Undef : getId(head);
     
     int size = parseInt(in);
     int neg = parseInt(in);
-    sum->bound = parseInt(in);    
+    int64_t bound = parseInt(in);
 
+    vec<Literal> lits;
+    vec<int64_t> weights;
     while(size-- > 0) {
         int atom = getId(parseInt(in));
-        if(neg-- > 0) sum->body.push(Literal(atom, Literal::NEG));
-        else sum->body.push(Literal(atom, Literal::POS));
-        sum->weights.push(1);
+        lits.push(Literal(atom, neg-- > 0 ? Literal::NEG : Literal::POS));
+        weights.push(1);
     }
     
-    add(sum);
+    addSumRule(headAtom, lits, weights, bound);
 }
 
 void AspSolver::parseSumRule(Glucose::StreamBuffer& in) {
     trace(asp_pre, 5, "Parsing sum rule...");
-    Sum* sum = new Sum();
-    sum->head = parseInt(in);
-    assert(sum->head != 1);
+    int head = parseInt(in);
+    Var headAtom = head == 1 ? var_Undef : getId(head);
     
-    sum->bound = parseInt(in);    
+    int64_t bound = parseInt(in);
     int size = parseInt(in);
     int neg = parseInt(in);
 
+    vec<Literal> lits;
     while(size-- > 0) {
         int atom = getId(parseInt(in));
-        if(neg-- > 0) sum->body.push(Literal(atom, Literal::NEG));
-        else sum->body.push(Literal(atom, Literal::POS));
+        lits.push(Literal(atom, neg-- > 0 ? Literal::NEG : Literal::POS));
     }
     
-    for(int i = 0; i < sum->body.size(); i++) sum->weights.push(parseInt(in));
+    vec<int64_t> weights;
+    for(int i = 0; i < lits.size(); i++) weights.push(parseInt(in));
 
-    add(sum);
+    addSumRule(headAtom, lits, weights, bound);
 }
 
-void AspSolver::add(Sum* sum) {
-    sumId[sum->head.id] = sum;
+void AspSolver::addSumRule(Var headAtom, const vec<Literal>& lits, vec<int64_t>& weights, int64_t bound) {
+    vec<Literal> body;
+    if(bound <= 0) {
+        addNormalRule(headAtom, body);
+        return;
+    }
     
-    // remove duplicates and false literals (and true negative literals)
-    tagCalls += 2;
-    int k = 0;
-    for(int i = 0; i < sum->body.size(); i++) {
-        Literal lit = sum->body[i];
-        if(lit.type == Literal::NEG) {
-            if(value(lit.id) == l_True) continue;
-            if(value(lit.id) == l_False) { sum->bound -= sum->weights[i]; continue; }
-        }
-        else {
-            assert(lit.type == Literal::POS);
-            if(value(lit.id) == l_False) continue;
-            if(value(lit.id) == l_True) { sum->posTrueWeight += sum->weights[i]; }
+    // weights are saturated to the bound, and divided by their greatest common divisor
+    int64_t gcd = 0;
+    for(int i = 0; i < weights.size(); i++) {
+        if(weights[i] > bound) weights[i] = bound;
+        for(int64_t a = weights[i] > 0 ? weights[i] : 0; a != 0;) { int64_t t = gcd % a; gcd = a; a = t; }
+    }
+    if(gcd == 0) return;
+    bound = (bound + gcd - 1) / gcd;
+    int64_t rest = 0;
+    for(int i = 0; i < weights.size(); i++) {
+        weights[i] = weights[i] > 0 ? weights[i] / gcd : 0;
+        rest += weights[i];
+    }
+    if(rest < bound) return;
+    
+    int size = 0;
+    for(int i = 0; i < weights.size(); i++) if(weights[i] > 0) size++;
+    if(bound > option_asp_counter_limit / size) {
+        trace(asp_pre, 8, "Sum rule with " << size << " literals and bound " << bound << " is processed after parsing.");
+        Sum* sum = new Sum();
+        sum->head = headAtom;
+        for(int i = 0; i < lits.size(); i++) {
+            if(weights[i] <= 0) continue;
+            sum->body.push(lits[i]);
+            sum->weights.push(weights[i]);
         }
-        
-        unsigned tmp = tagCalls - (sum->body[i].type == Literal::POS ? 1 : 0);
-        if(tag[sum->body[i].id] == tmp) {
-            for(int j = 0; j < i; j++) {
-                if(sum->body[j] == sum->body[i]) {
-                    sum->weights[j] += sum->weights[i];
-                    break;
-                }
+        sum->bound = bound;
+        aggregates.push(sum);
+        return;
+    }
+    addSumCounter(headAtom, lits, weights, static_cast<int>(bound));
+}
+
+void AspSolver::addSumCounter(Var headAtom, const vec<Literal>& lits, const vec<int64_t>& weights, int bound) {
+    // weight of the literals not processed yet
+    int64_t rest = 0;
+    for(int i = 0; i < weights.size(); i++) if(weights[i] > 0) rest += weights[i];
+    
+    // sequential counter: after the first i literals, partial[j] is an auxiliary atom derived when the weight of the true ones is at least j.
+    // Only the values from which the bound can still be reached are kept, and partial[j] is shared when literal i does not change it.
+    vec<Literal> body;
+    vec<Var> partial(bound + 1, var_Undef);
+    for(int i = 0; i < lits.size(); i++) {
+        if(weights[i] <= 0) continue;
+        rest -= weights[i];
+        for(int j = bound; j >= 1 && j + rest >= bound; j--) {
+            int from = weights[i] < j ? j - static_cast<int>(weights[i]) : 0;
+            if(from > 0 && partial[from] == var_Undef) continue;
+            Var aux = nVars();
+            newVar();
+            if(partial[j] != var_Undef) {
+                body.clear();
+                body.push(Literal(partial[j], Literal::POS));
+                addNormalRule(aux, body);
             }
+            body.clear();
+            body.push(lits[i]);
+            if(from > 0) body.push(Literal(partial[from], Literal::POS));
+            addNormalRule(aux, body);
+            partial[j] = aux;
+        }
+    }
+    trace(asp_pre, 8, "Sum rule replaced by normal rules on " << bound << " partial sums of " << lits.size() << " literals.");
+    
+    if(partial[bound] == var_Undef) return;
+    body.clear();
+    body.push(Literal(partial[bound], Literal::POS));
+    addNormalRule(headAtom, body);
+}
+
+void AspSolver::translateAggregates() {
+    if(aggregates.size() == 0) return;
+    
+    // positive dependencies of the rules, and of the aggregates: a head in a recursive component needs the normal rules of the counter
+    DepGraph dg;
+    for(int i = 0; i < nVars(); i++) dg.add(i);
+    for(int i = 0; i < ruleBegin.size(); i++) {
+        Rule rule = getRule(i);
+        for(int j = 0; j < rule.size(); j++) {
+            if(rule[j].type != Literal::SHEAD) continue;
+            for(int k = 0; k < rule.size(); k++) if(rule[k].type == Literal::POS) dg.add(rule[j].id, rule[k].id);
+        }
+    }
+    vec<bool> selfLoop(aggregates.size(), false);
+    for(int i = 0; i < aggregates.size(); i++) {
+        Sum& sum = *aggregates[i];
+        if(sum.head == var_Undef) continue;
+        for(int j = 0; j < sum.size(); j++) {
+            if(sum.body[j].type != Literal::POS) continue;
+            if(sum.body[j].id == sum.head) selfLoop[i] = true;
+            else dg.add(sum.head, sum.body[j].id);
+        }
+    }
+    vec<int> atom2comp(nVars());
+    vec<vec<int> > components;
+    bool tight_;
+    dg.sccs(atom2comp, components, tight_);
+    
+    int j = 0;
+    vec<Literal> body;
+    for(int i = 0; i < aggregates.size(); i++) {
+        Sum& sum = *aggregates[i];
+        if(sum.head != var_Undef && (supported[sum.head] || value(sum.head) == l_False)) {
+            if(supported[sum.head]) { delete aggregates[i]; continue; }
+            sum.head = var_Undef;
+        }
+        if(sum.head != var_Undef && (selfLoop[i] || components[atom2comp[sum.head]].size() > 1)) {
+            if(sum.bound >= INT32_MAX) cerr << "PARSE ERROR! Bound of recursive aggregate too large: " << sum.bound << endl, exit(3);
+            trace(asp_pre, 8, "Recursive sum rule replaced by normal rules.");
+            addSumCounter(sum.head, sum.body, sum.weights, static_cast<int>(sum.bound));
+            delete aggregates[i];
             continue;
         }
+        // the head is derived from a choice atom, which is true exactly when the weight of the true literals reaches the bound
+        if(sum.head != var_Undef) {
+            Var aux = nVars();
+            newVar();
+            ruleBegin.push(ruleLits.size());
+            ruleLits.push(Literal(aux, Literal::SHEAD));
+            ruleLits.push(Literal(aux, Literal::DNEG));
+            ruleSize.push(2);
+            body.clear();
+            body.push(Literal(aux, Literal::POS));
+            addNormalRule(sum.head, body);
+            sum.head = aux;
+        }
+        aggregates[j++] = aggregates[i];
+    }
+    aggregates.shrink(aggregates.size() - j);
+}
+
+void AspSolver::addAggregates() {
+    for(int i = 0; i < aggregates.size(); i++) {
+        Sum& sum = *aggregates[i];
+        int64_t total = 0;
+        for(int j = 0; j < sum.size(); j++) total += sum.weights[j];
         
-        tag[sum->body[i].id] = tmp;
-        sum->body[k] = sum->body[i];
-        sum->weights[k++] = sum->weights[i];
+        // the literals of the rule are true when their clause form is false
+        WeightConstraint wc;
+        for(int j = 0; j < sum.size(); j++) {
+            wc.lits.push(sum.body[j].toLit());
+            wc.coeffs.push(sum.weights[j]);
+        }
+        wc.bound = total - sum.bound + 1;
+        if(sum.head != var_Undef) {
+            wc.lits.push(mkLit(sum.head));
+            wc.coeffs.push(wc.bound);
+            
+            WeightConstraint wc2;
+            for(int j = 0; j < sum.size(); j++) {
+                wc2.lits.push(~sum.body[j].toLit());
+                wc2.coeffs.push(sum.weights[j]);
+            }
+            wc2.lits.push(~mkLit(sum.head));
+            wc2.coeffs.push(sum.bound);
+            wc2.bound = sum.bound;
+            for(int j = 0; j < wc2.size(); j++) setFrozen(var(wc2.lits[j]), true);
+            if(!addConstraint(wc2)) { ok = false; return; }
+        }
+        for(int j = 0; j < wc.size(); j++) setFrozen(var(wc.lits[j]), true);
+        if(!addConstraint(wc)) { ok = false; return; }
     }
-    sum->body.shrink(sum->body.size()-k);
-    sum->weights.shrink(sum->weights.size()-k);
+}
+
+void AspSolver::parseMinimizeRule(Glucose::StreamBuffer& in) {
+    trace(asp_pre, 5, "Parsing minimize rule...");
+    if(parseInt(in) != 0) cerr << "PARSE ERROR! Unexpected head in minimize rule." << endl, exit(3);
+    Sum* sum = new Sum();
     
-    if(sum->bound <= 0) {
-        supported[sum->head.id] = true;
-        addClause(mkLit(sum->head.id));
-        delete sum;
-        return;
+    int size = parseInt(in);
+    int neg = parseInt(in);
+
+    while(size-- > 0) {
+        int atom = getId(parseInt(in));
+        if(neg-- > 0) sum->body.push(Literal(atom, Literal::NEG));
+        else sum->body.push(Literal(atom, Literal::POS));
+    }
+    
+    for(int i = 0; i < sum->body.size(); i++) sum->weights.push(parseInt(in));
+    
+    minimize.push(sum);
+}
+
+void AspSolver::buildOccurrences() {
+    trace(asp_pre, 1, "Build occurrences of " << ruleBegin.size() << " rules...");
+    // also called to compact occurrences after simplifyProgram()
+    for(int t = 0; t < 5; t++) {
+        occBegin[t].clear();
+        occBegin[t].growTo(nVars() + 1, 0);
+        occRules[t].clear();
     }
-    if(sum->bound <= sum->posTrueWeight) addClause(mkLit(sum->head.id));
+    for(int i = 0; i < ruleBegin.size(); i++) {
+        Rule rule = getRule(i);
+        for(int j = 0; j < rule.size(); j++) occBegin[rule[j].type][rule[j].id + 1]++;
+    }
+    // a rule enters the UHEAD list of an atom only after leaving its SHEAD list
+    for(int v = 0; v < nVars(); v++) occBegin[Literal::UHEAD][v + 1] = occBegin[Literal::SHEAD][v + 1];
     
-    for(int i = 0; i < sum->body.size(); i++) sumOcc[Sum::type2idx(sum->body[i].type)][sum->body[i].id].push(sum);
-    sums.push(sum);
+    for(int t = 0; t < 5; t++) {
+        for(int v = 0; v < nVars(); v++) occBegin[t][v + 1] += occBegin[t][v];
+        occBegin[t].copyTo(occEnd[t]);
+        occRules[t].growTo(occBegin[t][nVars()]);
+    }
+    for(int i = 0; i < ruleBegin.size(); i++) {
+        Rule rule = getRule(i);
+        for(int j = 0; j < rule.size(); j++) occRules[rule[j].type][occEnd[rule[j].type][rule[j].id]++] = i;
+    }
+}
+
+void AspSolver::removeOcc(int type, Var v, int rule) {
+    for(int i = occBegin[type][v]; i < occEnd[type][v]; i++) {
+        if(occRules[type][i] != rule) continue;
+        occRules[type][i] = occRules[type][--occEnd[type][v]];
+        return;
+    }
 }
 
 void AspSolver::parse(gzFile in_) {
@@ -342,10 +548,16 @@ void AspSolver::parse(gzFile in_) {
         else if(type == 3) parseChoiceRule(in);
         else if(type == 2) parseCountRule(in);
         else if(type == 5) parseSumRule(in);
+        else if(type == 6) parseMinimizeRule(in);
         else cerr << "PARSE ERROR! Unexpected rule type: " << type << endl, exit(3);
-        propagate();
     }
     
+    translateAggregates();
+    
+    // rules are simplified on facts while parsing, and by propagation once all occurrences are known
+    buildOccurrences();
+    propagate();
+    
     trace(asp_pre, 1, "Parsing names...");
     int id;
     char buff[1024];
@@ -354,13 +566,22 @@ void AspSolver::parse(gzFile in_) {
         id = parseInt(in);
         if(id == 0) break;
         if(parseLine(in, buff, 1024) == -1) cerr << "PARSE ERROR! Atom name too long." << endl, exit(3);
+        if(id >= idmap.size() || idmap[id] == -1) {
+            trace(asp_pre, 15, "Atom id=" << id << " name=" << buff << " is not in any rule. It is false.");
+            continue;
+        }
         assert(!namemap.has(idmap[id]));
         namemap.insert(idmap[id], buff);
         trace(asp_pre, 15, "Atom " << idmap[id] << ": id=" << id << " name=" << getName(idmap[id]));
     }
     
     finalPropagation();
+    simplifyProgram();
     processComponents();
+    // constraints only discard answer sets, and atoms they make true at level 0 are not supported: they are added after the completion
+    for(int i = 0; i < constraints.size(); i++) if(!addClause(constraints[i])) break;
+    if(ok) addAggregates();
+    addMinimize();
     clearParsingStructures();
 //    for(int i = 0; i < nVars(); i++) setFrozen(i, true); // TODO: remove
     
@@ -368,14 +589,9 @@ void AspSolver::parse(gzFile in_) {
 }
 
 int AspSolver::getId(int input_id) {
-    assert(idmap.size() == occ[0].size() && idmap.size() == occ[1].size() && idmap.size() == occ[2].size() && idmap.size() == occ[3].size() && idmap.size() == occ[4].size());
     while(input_id >= idmap.size()) {
         idmap.push(-1);
-        for(int i = 0; i < 5; i++) occ[i].push();
-        sumId.push(NULL);
-        for(int i = 0; i < 2; i++) sumOcc[i].push();
     }
-    assert(idmap.size() == occ[0].size() && idmap.size() == occ[1].size() && idmap.size() == occ[2].size() && idmap.size() == occ[3].size() && idmap.size() == occ[4].size());
     if(idmap[input_id] == -1) { 
         trace(asp_pre, 10, "Atom " << nVars() << ": id=" << input_id);
         idmap[input_id] = nVars(); 
@@ -403,10 +619,12 @@ void AspSolver::newVar() {
     isBodyOf[0].push();
     isBodyOf[1].push();
     moreReasonWF.push(-1);
+    atomComp.push(-1);
+    inUnfounded.push(false);
 }
 
 bool AspSolver::eliminate(bool turn_off_elim) {
-    if(option_n != 1) {
+    if(option_n != 1 || strcmp(option_asp_reasoning, "none") != 0) {
         for(int i = 0; i < nVars(); i++)
             if(namemap.has(i))
                 setFrozen(i, true);
@@ -415,6 +633,10 @@ bool AspSolver::eliminate(bool turn_off_elim) {
 }
 
 lbool AspSolver::solve(int n) {
+    if(strcmp(option_asp_reasoning, "none") != 0) return solveConsequences(strcmp(option_asp_reasoning, "brave") == 0);
+    if(minimizeLevels > 0) return solveMinimize();
+    if(n != 1 && (option_asp_threads > 1 || option_asp_project || strcmp(option_asp_enumeration, "assumptions") == 0)) return enumerate(n);
+
     for(;;) {
         PseudoBooleanSolver::solve_();
         if(status == l_False) break;
@@ -429,10 +651,123 @@ lbool AspSolver::solve(int n) {
     }
     
     if(nModels == 0) cout << "UNSATISFIABLE" << endl;
+    if(option_asp_stats) printStatistics();
     
     return nModels == 0 ? l_False : l_True;
 }
 
+lbool AspSolver::solveMinimize() {
+    vec<int64_t> optima;
+    lbool ret = optimize(optima);
+    if(ret == l_False) cout << "UNSATISFIABLE" << endl;
+    else {
+        nModels++;
+        printModel();
+        cout << "Optimization:";
+        for(int i = 0; i < optima.size(); i++) cout << " " << optima[i];
+        cout << endl << "OPTIMUM FOUND" << endl;
+    }
+    if(option_asp_stats) printStatistics();
+    return ret;
+}
+
+void AspSolver::interrupt() {
+    // while optimizing, the best answer set found so far is printed with its costs
+    vec<int64_t> costs;
+    if(minimizeLevels == 0 || !bestCosts(costs)) cout << "s UNKNOWN" << endl;
+    else {
+        nModels++;
+        printModel();
+        cout << "Optimization:";
+        for(int i = 0; i < costs.size(); i++) cout << " " << costs[i];
+        cout << endl;
+    }
+    this->exit(1);
+}
+
+lbool AspSolver::solveConsequences(bool brave) {
+    cancelUntil(0);
+    assumptions.clear();
+    PseudoBooleanSolver::solve_();
+    if(status == l_False) cout << "UNSATISFIABLE" << endl;
+    if(status != l_True) return status;
+    
+    for(int i = 0; i < nVars(); i++) if(namemap.has(i)) shown.push(i);
+    vec<bool> estimate(nVars(), false);
+    vec<Var> atoms;
+    for(int i = 0; i < shown.size(); i++) if(value(shown[i]) == l_True) { estimate[shown[i]] = true; atoms.push(shown[i]); }
+    printAnswerSet(atoms);
+    
+    if(brave) {
+        // some atom not in the estimate must be true: each answer set adds at least one atom
+        vec<Lit> lits;
+        for(;;) {
+            cancelUntil(0);
+            lits.clear();
+            for(int i = 0; i < shown.size(); i++) if(!estimate[shown[i]]) lits.push(mkLit(shown[i]));
+            if(lits.size() == 0) break;
+            addClause(lits);
+            PseudoBooleanSolver::solve_();
+            if(status != l_True) break;
+            
+            atoms.clear();
+            for(int i = 0; i < shown.size(); i++) {
+                if(value(shown[i]) == l_True) estimate[shown[i]] = true;
+                if(estimate[shown[i]]) atoms.push(shown[i]);
+            }
+            printAnswerSet(atoms);
+        }
+    }
+    else {
+        // an atom of the estimate is assumed false: either it is confirmed, or the answer set removes it and possibly others
+        for(int i = 0; i < shown.size(); i++) {
+            if(!estimate[shown[i]]) continue;
+            cancelUntil(0);
+            if(value(shown[i]) == l_True) continue;
+            assumptions.clear();
+            assumptions.push(~mkLit(shown[i]));
+            PseudoBooleanSolver::solve_();
+            if(status == l_Undef) break;
+            if(status == l_False) {
+                cancelUntil(0);
+                addClause(mkLit(shown[i]));
+                continue;
+            }
+            
+            atoms.clear();
+            for(int j = 0; j < shown.size(); j++) {
+                if(value(shown[j]) != l_True) estimate[shown[j]] = false;
+                if(estimate[shown[j]]) atoms.push(shown[j]);
+            }
+            printAnswerSet(atoms);
+        }
+        assumptions.clear();
+    }
+    
+    if(option_asp_stats) printStatistics();
+    return status == l_Undef ? l_Undef : l_True;
+}
+
+void AspSolver::printStatistics() const {
+    uint64_t checks = 0, sets = 0, inferences = 0, conflicts = 0;
+    // threads run concurrently: their times are not summed, the longest one bounds the wall-clock time
+    double time = 0.0;
+    std::stringstream times;
+    for(int i = 0; i < (solvers.size() > 0 ? solvers.size() : 1); i++) {
+        const AspSolver& solver = solvers.size() > 0 ? *solvers[i] : *this;
+        checks += solver.wfChecks;
+        sets += solver.wfSets;
+        inferences += solver.wfInferences;
+        conflicts += solver.wfConflicts;
+        if(solver.wfTime > time) time = solver.wfTime;
+        times << (i > 0 ? ", " : "") << solver.wfTime;
+    }
+    cout << "c Unfounded set checks: " << checks << endl;
+    cout << "c Unfounded sets: " << sets << " (" << inferences << " inferences, " << conflicts << " conflicts)" << endl;
+    if(solvers.size() > 1) cout << "c Unfounded set check time: " << time << " s at most per thread (" << times.str() << ")" << endl;
+    else cout << "c Unfounded set check time: " << time << " s" << endl;
+}
+
 void AspSolver::printModel() const {
     cout << "Answer: " << nModels << endl;
     for(int i = 0; i < nVars(); i++)
@@ -453,82 +788,58 @@ void AspSolver::propagate() {
 void AspSolver::propagateTrue(Var v) {
     trace(asp_pre, 10, "Propagate true: " << getName(v));
     
-    for(int i = 0; i < occ[Literal::SHEAD][v].size(); i++)
-        onTrueHead(*(occ[Literal::SHEAD][v][i]), Literal(v, Literal::SHEAD));
-    for(int i = 0; i < occ[Literal::UHEAD][v].size(); i++)
-        onTrueHead(*(occ[Literal::UHEAD][v][i]), Literal(v, Literal::UHEAD));
+    for(int i = 0; i < occSize(Literal::SHEAD, v); i++)
+        onTrueHead(occRule(Literal::SHEAD, v, i), Literal(v, Literal::SHEAD));
+    for(int i = 0; i < occSize(Literal::UHEAD, v); i++)
+        onTrueHead(occRule(Literal::UHEAD, v, i), Literal(v, Literal::UHEAD));
         
-    for(int i = 0; i < occ[Literal::POS][v].size(); i++)
-        onTrueBody(*(occ[Literal::POS][v][i]), Literal(v, Literal::POS));
-    for(int i = 0; i < occ[Literal::DNEG][v].size(); i++)
-        onTrueBody(*(occ[Literal::DNEG][v][i]), Literal(v, Literal::DNEG));
+    for(int i = 0; i < occSize(Literal::POS, v); i++)
+        onTrueBody(occRule(Literal::POS, v, i), Literal(v, Literal::POS));
+    for(int i = 0; i < occSize(Literal::DNEG, v); i++)
+        onTrueBody(occRule(Literal::DNEG, v, i), Literal(v, Literal::DNEG));
 
-    for(int i = 0; i < occ[Literal::NEG][v].size(); i++)
-        onFalseBody(*(occ[Literal::NEG][v][i]));
-    
-    if(sumId[v] != NULL) onTrueHead(*sumId[v]);
-
-    vec<Sum*>& posSum = sumOcc[Sum::type2idx(Literal::POS)][v];
-    for(int i = 0; i < posSum.size(); i++)
-        onTrueBody(*posSum[i], Literal(v, Literal::POS));
-
-    vec<Sum*>& negSum = sumOcc[Sum::type2idx(Literal::NEG)][v];
-    for(int i = 0; i < negSum.size(); i++)
-        onFalseBody(*negSum[i], Literal(v, Literal::NEG));
+    for(int i = 0; i < occSize(Literal::NEG, v); i++)
+        onFalseBody(occRule(Literal::NEG, v, i));
 }
 
 void AspSolver::propagateFalse(Var v) {
     trace(asp_pre, 10, "Propagate false: " << getName(v));
 
-    for(int i = 0; i < occ[Literal::SHEAD][v].size(); i++)
-        onFalseHead(*(occ[Literal::SHEAD][v][i]), Literal(v, Literal::SHEAD));
-    for(int i = 0; i < occ[Literal::UHEAD][v].size(); i++)
-        onFalseHead(*(occ[Literal::UHEAD][v][i]), Literal(v, Literal::UHEAD));
-
-    for(int i = 0; i < occ[Literal::NEG][v].size(); i++)
-        onTrueBody(*(occ[Literal::NEG][v][i]), Literal(v, Literal::NEG));
-
-    for(int i = 0; i < occ[Literal::POS][v].size(); i++)
-        onFalseBody(*(occ[Literal::POS][v][i]));
-    for(int i = 0; i < occ[Literal::DNEG][v].size(); i++)
-        onFalseBody(*(occ[Literal::DNEG][v][i]));
+    for(int i = 0; i < occSize(Literal::SHEAD, v); i++)
+        onFalseHead(occRule(Literal::SHEAD, v, i), Literal(v, Literal::SHEAD));
+    for(int i = 0; i < occSize(Literal::UHEAD, v); i++)
+        onFalseHead(occRule(Literal::UHEAD, v, i), Literal(v, Literal::UHEAD));
 
-    if(sumId[v] != NULL) onFalseHead(*sumId[v]);
+    for(int i = 0; i < occSize(Literal::NEG, v); i++)
+        onTrueBody(occRule(Literal::NEG, v, i), Literal(v, Literal::NEG));
 
-    vec<Sum*>& posSum = sumOcc[Sum::type2idx(Literal::POS)][v];
-    for(int i = 0; i < posSum.size(); i++)
-        onFalseBody(*posSum[i], Literal(v, Literal::POS));
+    for(int i = 0; i < occSize(Literal::POS, v); i++)
+        onFalseBody(occRule(Literal::POS, v, i));
+    for(int i = 0; i < occSize(Literal::DNEG, v); i++)
+        onFalseBody(occRule(Literal::DNEG, v, i));}
 
-    vec<Sum*>& negSum = sumOcc[Sum::type2idx(Literal::NEG)][v];
-    for(int i = 0; i < negSum.size(); i++)
-        onTrueBody(*negSum[i], Literal(v, Literal::NEG));
-}
-
-void AspSolver::onTrueHead(vec<Literal>& rule, Literal headAtom) {
+void AspSolver::onTrueHead(int ruleId, Literal headAtom) {
+    Rule rule = getRule(ruleId);
     if(rule.size() == 0) return;
     
     for(int i = 0; i < rule.size(); i++) {
         if(rule[i] == headAtom) continue;
         if(rule[i].type == Literal::SHEAD) {
             rule[i].type = Literal::UHEAD;
-            vec<vec<Literal>*>& o = occ[Literal::SHEAD][headAtom.id];
-            int k = 0;
-            for(int j = 0; j < o.size(); j++) {
-                if(o[j] == &rule) continue;
-                o[k++] = o[j];
-            }
-            o.shrink(k-o.size());
-            if(o.size() == 0 || (o.size() == 1 && value(rule[i].id) == l_True && !supported[i])) supportInference.push(rule[i].id);
-            occ[Literal::UHEAD][headAtom.id].push(&rule);
+            removeOcc(Literal::SHEAD, headAtom.id, ruleId);
+            int size = occSize(Literal::SHEAD, headAtom.id);
+            if(size == 0 || (size == 1 && value(rule[i].id) == l_True && !supported[i])) supportInference.push(rule[i].id);
+            occRules[Literal::UHEAD][occEnd[Literal::UHEAD][headAtom.id]++] = ruleId;
         }
     }
 }
 
-void AspSolver::onFalseHead(vec<Literal>& rule, Literal headAtom) {
-    onTrueBody(rule, headAtom);
+void AspSolver::onFalseHead(int ruleId, Literal headAtom) {
+    onTrueBody(ruleId, headAtom);
 }
 
-void AspSolver::onTrueBody(vec<Literal>& rule, Literal bodyAtom) {
+void AspSolver::onTrueBody(int ruleId, Literal bodyAtom) {
+    Rule rule = getRule(ruleId);
     if(rule.size() == 0) return;
 
     bool trueBody = true;
@@ -537,7 +848,7 @@ void AspSolver::onTrueBody(vec<Literal>& rule, Literal bodyAtom) {
     for(int i = 0; i < rule.size(); i++) {
         if(rule[i] == bodyAtom) {
             if(bodyAtom.type != Literal::POS || supported[bodyAtom.id]) {
-                rule[i] = rule[rule.size()-1];
+                rule[i--] = rule[rule.size()-1];
                 rule.shrink(1);
             }
             else hasMustBeTrueBody = true;
@@ -572,70 +883,18 @@ void AspSolver::onTrueBody(vec<Literal>& rule, Literal bodyAtom) {
     }
 }
 
-void AspSolver::onFalseBody(vec<Literal>& rule) {
+void AspSolver::onFalseBody(int ruleId) {
+    Rule rule = getRule(ruleId);
     for(int i = 0; i < rule.size(); i++) {
         if(rule[i].type != Literal::SHEAD) continue;
         trace(asp_pre, 15, "Remove supporting rule for atom " << getName(rule[i].id));
-        vec<vec<Literal>*>& heads = occ[Literal::SHEAD][rule[i].id];
-        for(int j = 0; j < heads.size(); j++) {
-            if(heads[j] != &rule) continue;
-            heads[j] = heads[heads.size()-1];
-        }
-        heads.shrink(1);
-        if(heads.size() == 0 || (heads.size() == 1 && value(rule[i].id) == l_True && !supported[rule[i].id])) supportInference.push(rule[i].id);
+        removeOcc(Literal::SHEAD, rule[i].id, ruleId);
+        int size = occSize(Literal::SHEAD, rule[i].id);
+        if(size == 0 || (size == 1 && value(rule[i].id) == l_True && !supported[rule[i].id])) supportInference.push(rule[i].id);
     }
     rule.clear();
 }
 
-void AspSolver::onTrueHead(Sum& rule) {
-    // TODO
-}
-
-void AspSolver::onFalseHead(Sum& rule) {
-    // TODO
-    // CHECK: also on the other propagation, we must take care of other inferences
-}
-
-void AspSolver::onTrueBody(Sum& rule, Literal lit) {
-    if(rule.bound <= 0) return;
-    int j = 0;
-    for(int i = 0; i < rule.body.size(); i++) {
-        if(rule.body[i] == lit) {
-            if(lit.type == Literal::NEG) {
-                rule.bound -= rule.weights[i];
-                continue;
-            }
-            else rule.posTrueWeight += rule.weights[i];
-        }
-        rule.body[j++] = rule.body[i];
-        rule.weights[j++] = rule.weights[i];
-    }
-    rule.shrink(rule.size()-j);
-    if(rule.bound <= 0) {
-        addClause(rule.head.toLit());
-        supported[rule.head.id] = true;
-    }
-    else if(rule.bound <= rule.posTrueWeight)
-        addClause(rule.head.toLit());
-}
-
-void AspSolver::onFalseBody(Sum& rule, Literal lit) {
-    if(rule.bound <= 0) return;
-    int j = 0;
-    int ub = 0;
-    for(int i = 0; i < rule.body.size(); i++) {
-        if(rule.body[i] == lit) continue;
-        rule.body[j++] = rule.body[i];
-        rule.weights[j++] = rule.weights[i];
-        ub += rule.weights[i];
-    }
-    rule.shrink(rule.size()-j);
-    if(rule.bound > ub) {
-        addClause(~rule.head.toLit());
-        rule.bound = 0;
-    }
-}
-
 void AspSolver::finalPropagation() {
     trace(asp_pre, 1, "Start finalPropagation()...");
     assert(nextToPropagate == nextToPropagateByUnit());
@@ -651,23 +910,16 @@ void AspSolver::finalPropagation() {
         Var v = supportInference[supportInference.size()-1];
         supportInference.shrink(1);
         
-        if(sumId[v] != NULL) {
-            assert(value(v) == l_True);
-            cout << "SKIP FOR NOW" << endl; //TODO
-            continue;
-        }
-        
-        vec<vec<Literal>*>& heads = occ[Literal::SHEAD][v];
-        if(heads.size() == 0) {
+        if(occSize(Literal::SHEAD, v) == 0) {
             trace(asp_pre, 8, "Atom " << getName(v) << " has no support.");
             addClause(mkLit(v, true));
             continue;
         }
         
-        assert(heads.size() == 1 && value(v) == l_True && !supported[v]);
+        assert(occSize(Literal::SHEAD, v) == 1 && value(v) == l_True && !supported[v]);
         trace(asp_pre, 8, "Atom " << getName(v) << " is true and has a last supporting rule.");
         supported[v] = true;
-        vec<Literal>& rule = *heads[0];
+        Rule rule = getRule(occRule(Literal::SHEAD, v, 0));
         for(int i = 0; i < rule.size(); i++) {
             if(rule[i] == Literal(v, Literal::SHEAD)) continue;
             addClause(mkLit(rule[i].id, rule[i].type != Literal::POS && rule[i].type != Literal::DNEG));
@@ -679,10 +931,155 @@ void AspSolver::finalPropagation() {
 }
 
 bool AspSolver::hasSupportInference(Var atom) const {
-    if(sumId[atom] != NULL) return value(atom) == l_True;
-    return occ[Literal::SHEAD][atom].size() == 0 || (occ[Literal::SHEAD][atom].size() == 1 && value(atom) == l_True);
+    return occSize(Literal::SHEAD, atom) == 0 || (occSize(Literal::SHEAD, atom) == 1 && value(atom) == l_True);
 }
 
+static inline unsigned literalKey(const Literal& lit) { return ((unsigned) lit.id << 3) | lit.type; }
+
+struct LiteralLt {
+    bool operator()(const Literal& a, const Literal& b) const { return literalKey(a) < literalKey(b); }
+};
+
+// rules are ordered by a hash of their (sorted) body, so that rules with the same body are adjacent, and then by head
+struct RuleKey {
+    uint64_t body;
+    unsigned head;
+    int rule;
+};
+struct RuleKeyLt {
+    bool operator()(const RuleKey& a, const RuleKey& b) const { return a.body != b.body ? a.body < b.body : a.head < b.head; }
+};
+
+void AspSolver::simplifyProgram() {
+    if(!ok) return;
+    
+    // without simplification, each rule is its own body representative
+    bodyRep.growTo(ruleBegin.size());
+    for(int i = 0; i < bodyRep.size(); i++) bodyRep[i] = i;
+    bodyAux.growTo(ruleBegin.size(), lit_Undef);
+    if(!option_asp_simplify) return;
+    
+    trace(asp_pre, 1, "Start simplifyProgram()...");
+    
+    // atoms defined by a single rule a :- b are equivalent to b, and are unfolded in the other rules
+    vec<int> unfold(nVars(), -1);
+    for(int v = 0; v < nVars(); v++) {
+        if(value(v) != l_Undef || supported[v]) continue;
+        if(occSize(Literal::SHEAD, v) != 1 || occSize(Literal::UHEAD, v) != 0) continue;
+        Rule rule = getRule(occRule(Literal::SHEAD, v, 0));
+        if(rule.size() != 2) continue;
+        Literal lit = rule[0].type == Literal::SHEAD ? rule[1] : rule[0];
+        if(lit.type != Literal::POS || (int) lit.id == v || value(lit.id) != l_Undef) continue;
+        unfold[v] = lit.id;
+    }
+    int unfolded = 0;
+    for(int v = 0; v < nVars(); v++) {
+        if(unfold[v] == -1) continue;
+        tagCalls++;
+        int w = v;
+        tag[w] = tagCalls;
+        while(unfold[w] != -1 && tag[unfold[w]] != tagCalls) {
+            w = unfold[w];
+            tag[w] = tagCalls;
+        }
+        // a cycle of single definitions is broken on its last atom
+        if(unfold[w] != -1) unfold[w] = -1;
+        for(int x = v; x != w; ) {
+            int next = unfold[x];
+            unfold[x] = w;
+            x = next;
+        }
+        if(v != w) unfolded++;
+    }
+    
+    int unfoldedRules = 0;
+    for(int i = 0; i < ruleBegin.size(); i++) {
+        Rule rule = getRule(i);
+        if(rule.size() == 0) continue;
+        
+        // check first that the unfolded rule is still well-formed: no head in the body, and no complementary literals
+        bool changed = false;
+        bool valid = true;
+        tagCalls += 3;
+        for(int j = 0; j < rule.size(); j++) if(rule[j].type == Literal::SHEAD) tag[rule[j].id] = tagCalls - 2;
+        for(int j = 0; j < rule.size() && valid; j++) {
+            Literal lit = rule[j];
+            if(lit.type != Literal::POS && lit.type != Literal::NEG) continue;
+            int id = unfold[lit.id] == -1 ? (int) lit.id : unfold[lit.id];
+            if(id != (int) lit.id) {
+                changed = true;
+                if(tag[id] == tagCalls - 2) valid = false;
+            }
+            if(tag[id] == (lit.type == Literal::POS ? tagCalls : tagCalls - 1)) valid = false;
+            if(tag[id] != tagCalls - 2) tag[id] = lit.type == Literal::POS ? tagCalls - 1 : tagCalls;
+        }
+        if(!changed || !valid) continue;
+        
+        tagCalls += 2;
+        int k = 0;
+        for(int j = 0; j < rule.size(); j++) {
+            Literal lit = rule[j];
+            if(lit.type == Literal::POS || lit.type == Literal::NEG) {
+                if(unfold[lit.id] != -1) lit.id = unfold[lit.id];
+                unsigned tmp = tagCalls - (lit.type == Literal::POS ? 1 : 0);
+                if(tag[lit.id] == tmp) continue;
+                tag[lit.id] = tmp;
+            }
+            rule[k++] = lit;
+        }
+        rule.shrink(rule.size()-k);
+        unfoldedRules++;
+    }
+    
+    // rules with the same head and body are removed, and the others with the same body are grouped
+    vec<RuleKey> order;
+    for(int i = 0; i < ruleBegin.size(); i++) {
+        Rule rule = getRule(i);
+        if(rule.size() == 0) continue;
+        for(int j = 1; j < rule.size(); j++) {
+            if(rule[j].type != Literal::SHEAD) continue;
+            Literal tmp = rule[0];
+            rule[0] = rule[j];
+            rule[j] = tmp;
+            break;
+        }
+        if(rule[0].type != Literal::SHEAD) continue;
+        Glucose::sort((Literal*) ruleLits + ruleBegin[i] + 1, rule.size() - 1, LiteralLt());
+        order.push();
+        RuleKey& key = order.last();
+        key.body = rule.size();
+        for(int j = 1; j < rule.size(); j++) key.body = (key.body ^ literalKey(rule[j])) * 1099511628211ULL;
+        key.head = literalKey(rule[0]);
+        key.rule = i;
+    }
+    Glucose::sort(order, RuleKeyLt());
+    
+    int duplicates = 0;
+    int shared = 0;
+    int prev = -1;
+    for(int i = 0; i < order.size(); i++) {
+        Rule rule = getRule(order[i].rule);
+        if(prev != -1 && order[prev].body == order[i].body && ruleSize[order[prev].rule] == rule.size()) {
+            Rule other = getRule(order[prev].rule);
+            int j = 1;
+            while(j < rule.size() && rule[j] == other[j]) j++;
+            if(j == rule.size()) {
+                if(rule[0] == other[0]) {
+                    trace(asp_pre, 15, "Remove duplicate rule for atom " << getName(rule[0].id));
+                    rule.clear();
+                    duplicates++;
+                    continue;
+                }
+                bodyRep[order[i].rule] = bodyRep[order[prev].rule];
+                shared++;
+            }
+        }
+        prev = i;
+    }
+    
+    buildOccurrences();
+    trace(asp_pre, 1, "Simplification: " << unfolded << " atoms unfolded in " << unfoldedRules << " rules, " << duplicates << " duplicate rules removed, " << shared << " shared bodies");
+}
 void AspSolver::processComponents() {
     if(!ok) return;
     
@@ -693,21 +1090,9 @@ void AspSolver::processComponents() {
         if(value(i) == l_False) continue;
         if(supported[i]) continue;
         
-        if(sumId[i] != NULL) {
-            Sum& sum = *sumId[i];
-            for(int j = 0; j < sum.body.size(); j++) {
-                if(sum.body[j].type == Literal::POS) {
-                    assert(i != sum.body[j].id);
-                    dg.add(i, sum.body[j].id);
-                }
-            }
-            continue;
-        }
-
         for(int o = Literal::SHEAD; o <= Literal::UHEAD; o++) {
-            vec<vec<Literal>*>& heads = occ[o][i];
-            for(int j = 0; j < heads.size(); j++) {
-                vec<Literal>& rule = *heads[j];
+            for(int j = 0; j < occSize(o, i); j++) {
+                Rule rule = getRule(occRule(o, i, j));
                 for(int k = 0; k < rule.size(); k++) {
                     if(rule[k].type == Literal::POS) {
                         assert(i != rule[k].id);
@@ -720,8 +1105,8 @@ void AspSolver::processComponents() {
     
     vec<int> atom2comp(nVars());
     vec<vec<int> > components;
-    bool tight;
     dg.sccs(atom2comp, components, tight);
+    trace(asp_pre, 1, "The program is " << (tight ? "" : "not ") << "tight");
     vec<Lit> supp;
     for(int i = 0; i < components.size(); i++) {
         vec<int>& c = components[i];
@@ -733,37 +1118,65 @@ void AspSolver::processComponents() {
         }
         
         trace(asp_pre, 2, "Processing recursive component " << i);
+        int comp = compUnfounded.size();
+        compUnfounded.push();
         for(int j = 0; j < c.size(); j++) {
             completion(c[j], supp);
             setFrozen(c[j], true);
+            atomComp[c[j]] = comp;
             
-            unfounded.push(c[j]);
-            vec<vec<Literal>*>& heads = occ[Literal::SHEAD][c[j]];
-            for(int k = 0; k < heads.size(); k++) {
-                vec<Literal>* rule = new vec<Literal>();
-                heads[k]->copyTo(*rule);
-                recursiveRules.push(rule);
+            addUnfounded(c[j]);
+            for(int k = 0; k < occSize(Literal::SHEAD, c[j]); k++) {
+                Rule rule = getRule(occRule(Literal::SHEAD, c[j], k));
+                int rec = possibleSourcePointerOf.size();
                 body.push(supp.size() == 0 ? mkLit(c[j]) : supp[k]);
                 recBody.push();
-                isBodyOf[sign(body[body.size()-1])][var(body[body.size()-1])].push(recursiveRules.size()-1);
+                isBodyOf[sign(body[body.size()-1])][var(body[body.size()-1])].push(rec);
                 withoutSourcePointer.push(0);
                 possibleSourcePointerOf.push(c[j]);
-                possibleSourcePointers[c[j]].push(recursiveRules.size()-1);
-                for(int idx = 0; idx < rule->size(); idx++) {
-                    Literal lit = rule->operator[](idx);
+                possibleSourcePointers[c[j]].push(rec);
+                for(int idx = 0; idx < rule.size(); idx++) {
+                    Literal lit = rule[idx];
                     if(lit == Literal(c[j], Literal::SHEAD)) continue;
                     if(lit == Literal(c[j], Literal::UHEAD)) continue;
-                    inBody[lit.type == Literal::POS || lit.type ==  Literal::DNEG ? 1 : 0][lit.id].push(recursiveRules.size()-1);
+                    inBody[lit.type == Literal::POS || lit.type ==  Literal::DNEG ? 1 : 0][lit.id].push(rec);
                     if(lit.type == Literal::POS && atom2comp[lit.id] == i) {
-                        inRecBody[lit.id].push(recursiveRules.size()-1); 
-                        withoutSourcePointer[withoutSourcePointer.size()-1]++;
-                        recBody[recBody.size()-1].push(lit.id);
+                        inRecBody[lit.id].push(rec); 
+                        withoutSourcePointer[rec]++;
+                        recBody[rec].push(lit.id);
                     }
                 }
             }
         }
-        if(!findSourcePointers()) ok = false;
+        if(!findSourcePointers(comp)) ok = false;
+        dirtyComps.clear();
+    }
+}
+
+void AspSolver::addMinimize() {
+    if(minimize.size() == 0) return;
+    trace(asp_pre, 1, "Add " << minimize.size() << " minimize statements...");
+    minimizeLevels = minimize.size();
+    
+    // the cost of a literal is paid when it is true, so its clause form is the soft literal
+    vec<Lit> lits;
+    for(int i = 0; i < minimize.size(); i++) {
+        Sum& sum = *minimize[i];
+        for(int j = 0; j < sum.size(); j++) {
+            lits.clear();
+            lits.push(sum.body[j].toLit());
+            if(minimizeLevels == 1) addWeightedClause(lits, sum.weights[j]);
+            else addWeightedClause(lits, sum.weights[j], i);
+        }
+    }
+    
+    // complementary soft literals cancel out and are unfrozen, but atoms may be in recursive components
+    for(int i = 0; i < minimize.size(); i++) {
+        Sum& sum = *minimize[i];
+        for(int j = 0; j < sum.size(); j++) setFrozen(sum.body[j].id, true);
+        delete minimize[i];
     }
+    minimize.clear();
 }
 
 void AspSolver::completion(Var i, vec<Lit>& supp) {
@@ -772,30 +1185,21 @@ void AspSolver::completion(Var i, vec<Lit>& supp) {
     assert(value(i) != l_False);
     assert(!supported[i]);
     
-    if(sumId[i] != NULL) {
-        Sum& sum = *sumId[i];
-        trace(asp_pre, 5, "Processing sum atom " << i << ": " << sum);
-        WeightConstraint wc;
-        for(int j = 0; j < sum.size(); j++) {
-            wc.lits.push(~sum.body[j].toLit());
-            wc.coeffs.push(sum.weights[j]);
-        }
-        wc.lits.push(~sum.head.toLit());
-        wc.coeffs.push(sum.bound);
-        wc.bound = sum.bound;
-        addConstraint(wc);
-        return;
-    }
-        
-        
-    vec<vec<Literal>*>& heads = occ[Literal::SHEAD][i];
-    assert_msg(heads.size() > 0, "Atom " << getName(i) << " has " << heads.size() << " definitions.");
-    trace(asp_pre, 5, "Processing atom " << i << " with " << heads.size() << " possibly supporting rules.");
-    if(heads.size() == 1) {
+    int heads = occSize(Literal::SHEAD, i);
+    assert_msg(heads > 0, "Atom " << getName(i) << " has " << heads << " definitions.");
+    trace(asp_pre, 5, "Processing atom " << i << " with " << heads << " possibly supporting rules.");
+    if(heads == 1) {
         if(value(i) == l_True) return;
         assert(!supported[i]);
         assert(value(i) == l_Undef);
-        vec<Literal>& rule = *heads[0];
+        int r = occRule(Literal::SHEAD, i, 0);
+        Rule rule = getRule(r);
+        if(rule.size() > 2 && bodyAux[bodyRep[r]] != lit_Undef) {
+            trace(asp_pre, 8, "Atom " << getName(i) << " is equivalent to " << bodyAux[bodyRep[r]]);
+            addClause(~mkLit(i), bodyAux[bodyRep[r]]);
+            addClause(mkLit(i), ~bodyAux[bodyRep[r]]);
+            return;
+        }
         vec<Lit> lits;
         for(int j = 0; j < rule.size(); j++) {
             lits.push(rule[j].toLit());
@@ -803,17 +1207,23 @@ void AspSolver::completion(Var i, vec<Lit>& supp) {
             addClause(~mkLit(i), ~rule[j].toLit());
         }
         addClause(lits);
+        if(rule.size() > 2) bodyAux[bodyRep[r]] = mkLit(i);
         return;
     }
     
-    for(int j = 0; j < heads.size(); j++) {
-        vec<Literal>& rule = *heads[j];
+    for(int j = 0; j < heads; j++) {
+        int r = occRule(Literal::SHEAD, i, j);
+        Rule rule = getRule(r);
         assert(rule.size() >= 2);
         Lit aux;
         if(rule.size() == 2) {
             aux = rule[0] == Literal(i, Literal::SHEAD) ? ~rule[1].toLit() : ~rule[0].toLit();
             addClause(rule[0].toLit(), rule[1].toLit());
         }
+        else if(bodyAux[bodyRep[r]] != lit_Undef) {
+            aux = bodyAux[bodyRep[r]];
+            addClause(~aux, mkLit(i));
+        }
         else {
             aux = mkLit(nVars());
             newVar();
@@ -826,6 +1236,7 @@ void AspSolver::completion(Var i, vec<Lit>& supp) {
                 addClause(~aux, ~rule[k].toLit());
             }
             addClause(lits);
+            bodyAux[bodyRep[r]] = aux;
 //            assert(nextToPropagate == nextToPropagateByUnit()); //TODO:add it back
         }
         supp.push(aux);
@@ -835,118 +1246,132 @@ void AspSolver::completion(Var i, vec<Lit>& supp) {
     supp.pop();
 }
 
+// with parallel enumeration, the CPU time of the process would also count the other solvers
+static double threadCpuTime() {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec / 1000000000;
+}
+
+struct ComponentUnfoundedLt {
+    const vec<vec<int> >& unfounded;
+    ComponentUnfoundedLt(const vec<vec<int> >& unfounded_) : unfounded(unfounded_) {}
+    bool operator()(int a, int b) const { return unfounded[a].size() < unfounded[b].size(); }
+};
+
 CRef AspSolver::morePropagate() {
+    if(tight) return MaxSatSolver::morePropagate();
     CRef ret = MaxSatSolver::morePropagate();
     if(ret != CRef_Undef) return ret;
-    while(nextToPropagate < nextToPropagateByUnit()) {
-        ret = morePropagate(mainTrail(nextToPropagate++));
-        if(ret != CRef_Undef) return ret;
+    if(nextToPropagate == nextToPropagateByUnit() && dirtyComps.size() == 0) return ret;
+    double start = option_asp_stats ? threadCpuTime() : 0.0;
+
+    // the whole fixpoint of unit propagation is processed at once, and only components with atoms without source pointer are checked
+    while(nextToPropagate < nextToPropagateByUnit()) invalidateSourcePointers(mainTrail(nextToPropagate++));
+
+    // components are independent; smaller ones are cheaper, and a conflict there saves the check of the larger ones
+    Glucose::sort(dirtyComps, ComponentUnfoundedLt(compUnfounded));
+    for(int i = 0; i < dirtyComps.size(); i++) {
+        trace(asp, 10, "Check component " << dirtyComps[i] << " with " << compUnfounded[dirtyComps[i]].size() << " atoms without source pointer");
+        if(!findSourcePointers(dirtyComps[i])) { ret = CRef_MoreConflict; break; }
     }
+    // after a conflict, the atoms of the unchecked components are still without source pointer
+    int j = 0;
+    for(int i = 0; i < dirtyComps.size(); i++) if(compUnfounded[dirtyComps[i]].size() > 0) dirtyComps[j++] = dirtyComps[i];
+    dirtyComps.shrink_(dirtyComps.size() - j);
+
+    if(option_asp_stats) wfTime += threadCpuTime() - start;
     return ret;
 }
 
-CRef AspSolver::morePropagate(Lit lit) {
+void AspSolver::addUnfounded(int atom) {
+    if(inUnfounded[atom]) return;
+    inUnfounded[atom] = true;
+    vec<int>& u = compUnfounded[atomComp[atom]];
+    if(u.size() == 0) dirtyComps.push(atomComp[atom]);
+    u.push(atom);
+}
+
+void AspSolver::invalidateSourcePointers(Lit lit) {
     trace(asp, 10, "Propagating " << lit << "@" << level(var(lit)) << " (atom " << var(lit) << "/" << getName(var(lit)) << ")");
 
-    tagCalls++;
-    assert(unfounded.size() == 0);
-    
+    // the head loses its source pointer even if false, as it may be unassigned by backjumping while the body stays false
     vec<int>& in = isBodyOf[1-sign(lit)][var(lit)];
     for(int i = 0; i < in.size(); i++) {
         int ruleIdx = in[i];
         int head = possibleSourcePointerOf[ruleIdx];
-        if(value(mkLit(head)) == l_False) continue;
-        if(sourcePointer[head] == ruleIdx) {
-            int last = unfounded.size();
-            tag[head] = tagCalls;
-            unfounded.push(head);
-            do{
-                int a = unfounded[last++];
-                trace(asp, 15, "Atom " << a << "/" << getName(a) << " unfounded");
-                for(int k = 0; k < inRecBody[a].size(); k++) {
-                    if(value(mkLit(possibleSourcePointerOf[inRecBody[a][k]])) == l_False) continue;
-                    withoutSourcePointer[inRecBody[a][k]]++;
-                    if(tag[possibleSourcePointerOf[inRecBody[a][k]]] != tagCalls) {
-                        tag[possibleSourcePointerOf[inRecBody[a][k]]] = tagCalls;
-                        unfounded.push(possibleSourcePointerOf[inRecBody[a][k]]);
-                    }
-                }
-            }while(last < unfounded.size());
-        }
+        if(sourcePointer[head] != ruleIdx) continue;
+
+        assert(stackA.size() == 0);
+        sourcePointer[head] = -1;
+        stackA.push(head);
+        do{
+            int a = stackA.last();
+            stackA.pop();
+            trace(asp, 15, "Atom " << a << "/" << getName(a) << " without source pointer");
+            addUnfounded(a);
+            for(int k = 0; k < inRecBody[a].size(); k++) {
+                int rec = inRecBody[a][k];
+                withoutSourcePointer[rec]++;
+                if(sourcePointer[possibleSourcePointerOf[rec]] != rec) continue;
+                sourcePointer[possibleSourcePointerOf[rec]] = -1;
+                stackA.push(possibleSourcePointerOf[rec]);
+            }
+        }while(stackA.size() > 0);
     }
-    
-//    vec<int>& in = inBody[1-sign(lit)][var(lit)];
-//    for(int i = 0; i < in.size(); i++) {
-//        cout << i << endl;
-//        int ruleIdx = in[i];
-//        int head = possibleSourcePointerOf[ruleIdx];
-//        if(sourcePointer[head] == ruleIdx) {
-//            int last = unfounded.size();
-//            unfounded.push(head);
-//            trace(asp, 15, "Atom " << head << "/" << getName(head) << " unfounded");
-//            do{
-//                int a = unfounded[last];
-//                tag[a] = tagCalls;
-//                for(int k = 0; k < inRecBody[a].size(); k++) {
-//                    withoutSourcePointer[inRecBody[a][k]]++;
-//                    if(tag[possibleSourcePointerOf[inRecBody[a][k]]] != tagCalls)
-//                        ;//unfounded.push(tag[possibleSourcePointerOf[inRecBody[a][k]]]);
-//                }
-//            }while(++last < unfounded.size());
-//        }
-//    }
-    if(!findSourcePointers()) return CRef_MoreConflict;
+}
 
-    return CRef_Undef;
+void AspSolver::setSourcePointer(int atom, int rec) {
+    assert(stackA.size() == 0 && stackR.size() == 0);
+    stackA.push(atom);
+    stackR.push(rec);
+    do{
+        int a = stackA.last();
+        sourcePointer[a] = stackR.last();
+        stackA.pop();
+        stackR.pop();
+        trace(asp, 15, "New source pointer for atom " << a << "/" << getName(a) << ": " << sourcePointer[a]);
+        for(int k = 0; k < inRecBody[a].size(); k++) {
+            int rec = inRecBody[a][k];
+            if(--withoutSourcePointer[rec] != 0) continue;
+            int head = possibleSourcePointerOf[rec];
+            if(sourcePointer[head] != -1 || value(head) == l_False || value(body[rec]) == l_False) continue;
+            // the source pointer is set when pushed, so that the head is not pushed twice
+            sourcePointer[head] = rec;
+            stackA.push(head);
+            stackR.push(rec);
+        }
+    }while(stackA.size() > 0);
 }
 
-bool AspSolver::findSourcePointers() {
-    trace(asp, 10, "Find source pointers for " << unfounded);
-    tagCalls++;
-    for(int i = 0; i < unfounded.size(); i++) {
-        int atom = unfounded[i];
-        assert(value(atom) != l_False);
-        if(tag[atom] == tagCalls) continue;
+bool AspSolver::findSourcePointers(int comp) {
+    vec<int>& u = compUnfounded[comp];
+    trace(asp, 10, "Find source pointers for " << u);
+    if(u.size() == 0) return true;
+    wfChecks++;
+    for(int i = 0; i < u.size(); i++) {
+        int atom = u[i];
+        if(sourcePointer[atom] != -1 || value(atom) == l_False) continue;
         vec<int>& poss = possibleSourcePointers[atom];
         for(int j = 0; j < poss.size(); j++) {
             if(value(body[poss[j]]) == l_False) continue;
             if(withoutSourcePointer[poss[j]] != 0) continue;
-            
-            vec<int> stackA;
-            vec<int> stackR;
-            tag[atom] = tagCalls;
-            stackA.push(atom);
-            stackR.push(poss[j]);
-            
-            do{
-                int a = stackA[stackA.size()-1];
-                sourcePointer[a] = stackR[stackR.size()-1];
-                stackA.shrink(1);
-                stackR.shrink(1);
-                trace(asp, 15, "New source pointer for atom " << a << "/" << getName(a) << ": " << sourcePointer[a]);
-                for(int k = 0; k < inRecBody[a].size(); k++) {
-                    if(value(possibleSourcePointerOf[inRecBody[a][k]]) == l_False) continue;
-                    if(--withoutSourcePointer[inRecBody[a][k]] == 0 && tag[possibleSourcePointerOf[inRecBody[a][k]]] != tagCalls) {
-                        tag[possibleSourcePointerOf[inRecBody[a][k]]] = tagCalls;
-                        stackA.push(possibleSourcePointerOf[inRecBody[a][k]]);
-                        stackR.push(inRecBody[a][k]);
-                    }
-                }
-            }while(stackA.size() > 0);
-
+            setSourcePointer(atom, poss[j]);
             break;
         }
     }
     
-    // remove founded atoms
+    // founded atoms are done; false atoms are checked again when unassigned
+    assert(unfounded.size() == 0);
     int j = 0;
-    for(int i = 0; i < unfounded.size(); i++) {
-        int atom = unfounded[i];
-        if(tag[atom] == tagCalls) continue;
-        unfounded[j++] = unfounded[i];
-        withoutSourcePointer[sourcePointer[atom]] = 0;
+    for(int i = 0; i < u.size(); i++) {
+        int atom = u[i];
+        if(sourcePointer[atom] != -1) { inUnfounded[atom] = false; continue; }
+        if(value(atom) == l_False) { inUnfounded[atom] = false; addFalseUnfounded(atom, level(atom)); continue; }
+        u[j++] = atom;
+        unfounded.push(atom);
     }
-    unfounded.shrink_(unfounded.size()-j);
+    u.shrink_(u.size()-j);
     
     // look for inconsistency
     for(int i = 0; i < unfounded.size(); i++) {
@@ -959,15 +1384,17 @@ bool AspSolver::findSourcePointers() {
         break;
     }
     
-    // identify small unfounded sets and reasons
-    tagCalls++;
+    // identify small unfounded sets and reasons: tagCalls-1 marks atoms not yet in a set
+    tagCalls += 2;
+    for(int i = 0; i < unfounded.size(); i++) tag[unfounded[i]] = tagCalls - 1;
     for(int i = 0; i < unfounded.size(); i++) {
         if(tag[unfounded[i]] == tagCalls) continue;
         tag[unfounded[i]] = tagCalls;
         
-        moreReasonWFVec.push();
-        vec<Lit>& reasons = moreReasonWFVec.last();
-        vec<int> uSet;
+        int set = moreReasonWFBegin.size();
+        moreReasonWFBegin.push(moreReasonWFLits.size());
+        wfSets++;
+        uSet.clear();
         uSet.push(unfounded[i]);
         int processed = 0;
         while(processed < uSet.size()) {
@@ -975,48 +1402,63 @@ bool AspSolver::findSourcePointers() {
             vec<int>& poss = possibleSourcePointers[atom];
             for(int j = 0; j < poss.size(); j++) {
                 if(value(body[poss[j]]) == l_False) {
-                    reasons.push(body[poss[j]]);
+                    moreReasonWFLits.push(body[poss[j]]);
                     continue;
                 }
+                // the rule depends on the set, or it is blocked by a false atom (possibly of a previous set), or by an atom not yet in a set
                 vec<int>& rec = recBody[poss[j]];
                 assert(rec.size() > 0);
+                bool inSet = false;
+                int falseAtom = -1;
                 int toBeAdd = -1;
-                for(int i = 0; i < rec.size(); i++) {
-                    if(tag[rec[i]] == tagCalls) {
-                        if(value(rec[i]) != l_False) continue;
-                        reasons.push(mkLit(rec[i]));
-                        toBeAdd = -1;
-                        break;
-                    }
-                    toBeAdd = rec[i];
-                }
-                if(toBeAdd != -1) {
-                    uSet.push(toBeAdd);
-                    tag[toBeAdd] = tagCalls;
+                for(int k = 0; k < rec.size(); k++) {
+                    if(value(rec[k]) == l_False) { if(falseAtom == -1) falseAtom = rec[k]; continue; }
+                    if(tag[rec[k]] == tagCalls) { inSet = true; break; }
+                    if(tag[rec[k]] == tagCalls - 1) toBeAdd = rec[k];
                 }
+                if(inSet) continue;
+                if(falseAtom != -1) { moreReasonWFLits.push(mkLit(falseAtom)); continue; }
+                assert(toBeAdd != -1);
+                uSet.push(toBeAdd);
+                tag[toBeAdd] = tagCalls;
             }
         }
-        trace(asp, 15, "Unfounded set (atoms) " << uSet << " with reasons (literals) " << reasons);
+        trace(asp, 15, "Unfounded set (atoms) " << uSet << " with " << (moreReasonWFLits.size() - moreReasonWFBegin[set]) << " reasons");
         for(int j = 0; j < uSet.size(); j++) {
             int v = uSet[j];
-            trace(asp, 20, "Inferring atom " << v << "/" << getName(v) << "@" << decisionLevel() << " from unfounded set");
             assert(moreReasonWF[v] == -1);
-            moreReasonWF[v] = moreReasonWFVec.size()-1;
-            moreReasonVars.push(v);
             if(value(v) == l_True) {
+                // the set is the reason of the conflict only, and it is popped on backtracking; atoms stay in the component
                 moreConflictLit = ~mkLit(v);
-                moreConflictWF = moreReasonWFVec.size() - 1;
+                moreConflictWF = set;
+                wfConflicts++;
                 unfounded.clear();
                 return false;
             }
-            else uncheckedEnqueue(~mkLit(v));
+            trace(asp, 20, "Inferring atom " << v << "/" << getName(v) << "@" << decisionLevel() << " from unfounded set");
+            moreReasonWF[v] = set;
+            moreReasonVars.push(v);
+            wfInferences++;
+            uncheckedEnqueue(~mkLit(v));
         }
     }
     
+    for(int i = 0; i < unfounded.size(); i++) {
+        inUnfounded[unfounded[i]] = false;
+        addFalseUnfounded(unfounded[i], decisionLevel());
+    }
     unfounded.clear();
+    u.clear();
     return true;
 }
 
+void AspSolver::addFalseUnfounded(int atom, int lev) {
+    if(lev == 0) return;
+    if(falseUnfounded.size() <= lev) falseUnfounded.growTo(lev + 1);
+    falseUnfounded[lev].push(atom);
+    if(falseUnfoundedLevels <= lev) falseUnfoundedLevels = lev + 1;
+}
+
 bool AspSolver::moreReason(Lit lit, vec<Lit>& out_learnt, vec<Lit>& selectors, int& pathC) {
     if(PseudoBooleanSolver::moreReason(lit, out_learnt, selectors, pathC)) return true;
     if(moreReasonWF[var(lit)] != -1) { _moreReasonWF(lit, out_learnt, selectors, pathC); return true; }
@@ -1026,9 +1468,9 @@ bool AspSolver::moreReason(Lit lit, vec<Lit>& out_learnt, vec<Lit>& selectors, i
 void AspSolver::_moreReasonWF(Lit lit, vec<Lit>& out_learnt, vec<Lit>& selectors, int& pathC) {
     assert(decisionLevel() != 0);
     assert(reason(var(lit)) == CRef_Undef);
-    vec<Lit>& reasons = moreReasonWFVec[moreReasonWF[var(lit)]];
-    for(int i = 0; i < reasons.size(); i++) {
-        Lit q = reasons[i];
+    int set = moreReasonWF[var(lit)];
+    for(int i = moreReasonWFBegin[set]; i < moreReasonWFEnd(set); i++) {
+        Lit q = moreReasonWFLits[i];
         assert(value(q) == l_False);
         assert(level(var(q)) <= level(var(lit)));
         
@@ -1058,6 +1500,7 @@ void AspSolver::_moreReasonWF(Lit lit, vec<Lit>& out_learnt, vec<Lit>& selectors
 }
 
 bool AspSolver::moreReason(Lit lit) {
+    if(PseudoBooleanSolver::moreReason(lit)) return true;
     if(moreReasonWF[var(lit)] != -1) { _moreReasonWF(lit); return true; }
     return false;
 }
@@ -1065,9 +1508,9 @@ bool AspSolver::moreReason(Lit lit) {
 void AspSolver::_moreReasonWF(Lit lit) {
     assert(decisionLevel() != 0);
     assert(reason(var(lit)) == CRef_Undef);
-    vec<Lit>& reasons = moreReasonWFVec[moreReasonWF[var(lit)]];
-    for(int i = 0; i < reasons.size(); i++) {
-        Lit l = reasons[i];
+    int set = moreReasonWF[var(lit)];
+    for(int i = moreReasonWFBegin[set]; i < moreReasonWFEnd(set); i++) {
+        Lit l = moreReasonWFLits[i];
         assert(value(l) == l_False);
         assert(level(var(l)) <= level(var(lit)));
         if(level(var(l)) == 0) continue;
@@ -1076,6 +1519,7 @@ void AspSolver::_moreReasonWF(Lit lit) {
 }
 
 bool AspSolver::moreConflict(vec<Lit>& out_learnt, vec<Lit>& selectors, int& pathC) {
+    if(PseudoBooleanSolver::moreConflict(out_learnt, selectors, pathC)) return true;
     if(moreConflictWF != -1) { _moreConflictWF(out_learnt, selectors, pathC); return true; }
     return false;
 }
@@ -1086,17 +1530,23 @@ void AspSolver::_moreConflictWF(vec<Lit>& out_learnt, vec<Lit>& selectors, int&
     if(!seen[var(moreConflictLit)] && level(var(moreConflictLit)) > 0) {
         if(!isSelector(var(moreConflictLit))) varBumpActivity(var(moreConflictLit));
         seen[var(moreConflictLit)] = 1;
-        assert(level(var(moreConflictLit)) == decisionLevel());
-        pathC++;
-        // UPDATEVARACTIVITY trick (see competition'09 companion paper)
-        if(!isSelector(var(moreConflictLit)) && (reason(var(moreConflictLit)) != CRef_Undef) && ca[reason(var(moreConflictLit))].learnt())
-            lastDecisionLevel.push(moreConflictLit);
+        // the unfounded atom may be true since a previous level, as in enumeration under assumptions
+        if(level(var(moreConflictLit)) >= decisionLevel()) {
+            pathC++;
+            // UPDATEVARACTIVITY trick (see competition'09 companion paper)
+            if(!isSelector(var(moreConflictLit)) && (reason(var(moreConflictLit)) != CRef_Undef) && ca[reason(var(moreConflictLit))].learnt())
+                lastDecisionLevel.push(moreConflictLit);
+        }
+        else if(isSelector(var(moreConflictLit)))
+            selectors.push(moreConflictLit);
+        else
+            out_learnt.push(moreConflictLit);
     }
     
-    vec<Lit>& reasons = moreReasonWFVec[moreConflictWF];
+    int set = moreConflictWF;
     moreConflictWF = -1;
-    for(int i = 0; i < reasons.size(); i++) {
-        Lit q = reasons[i];
+    for(int i = moreReasonWFBegin[set]; i < moreReasonWFEnd(set); i++) {
+        Lit q = moreReasonWFLits[i];
         assert(value(q) == l_False);
         
         if(seen[var(q)]) continue;
@@ -1125,15 +1575,21 @@ void AspSolver::_moreConflictWF(vec<Lit>& out_learnt, vec<Lit>& selectors, int&
 }
 
 void AspSolver::clearParsingStructures() {
-    for(int i = 0; i < program.size(); i++) delete program[i];
-    { vec<vec<Literal>*> tmp; program.moveTo(tmp); }
-    
-    for(int i = 0; i < sums.size(); i++) delete sums[i];
-    { vec<Sum*> tmp; sums.moveTo(tmp); }
+    { vec<Literal> tmp; ruleLits.moveTo(tmp); }
+    { vec<int> tmp; ruleBegin.moveTo(tmp); }
+    { vec<int> tmp; ruleSize.moveTo(tmp); }
+    { vec<vec<Lit> > tmp; constraints.moveTo(tmp); }
+    for(int i = 0; i < aggregates.size(); i++) delete aggregates[i];
+    { vec<Sum*> tmp; aggregates.moveTo(tmp); }
     
-    { vec<Sum*> tmp; sumId.moveTo(tmp); }
+    { vec<int> tmp; bodyRep.moveTo(tmp); }
+    { vec<Lit> tmp; bodyAux.moveTo(tmp); }
 
-    for(int i = 0; i < 7; i++) { vec<vec<vec<Literal>*> > tmp; occ[i].moveTo(tmp); }
+    for(int i = 0; i < 5; i++) {
+        { vec<int> tmp; occRules[i].moveTo(tmp); }
+        { vec<int> tmp; occBegin[i].moveTo(tmp); }
+        { vec<int> tmp; occEnd[i].moveTo(tmp); }
+    }
     { vec<bool> tmp; supported.moveTo(tmp); }
     
     { vec<Var> tmp; supportInference.moveTo(tmp); }
@@ -1141,6 +1597,7 @@ void AspSolver::clearParsingStructures() {
 
 void AspSolver::onCancel() {
     MaxSatSolver::onCancel();
+    if(tight) return;
     
     trace(asp, 2, "Cancel until level " << decisionLevel());
     while(nextToPropagate > nextToPropagateByUnit()) { 
@@ -1152,10 +1609,209 @@ void AspSolver::onCancel() {
         Var v = moreReasonVars.last();
         if(level(v) <= decisionLevel()) break;
         moreReasonVars.pop();
-        if(moreReasonWF[v] < moreReasonWFVec.size()-1) moreReasonWFVec.pop();
         moreReasonWF[v] = -1;
     }
+    // sets are created in order, and the last one still used is the reason of the last inferred atom
+    int sets = moreReasonVars.size() > 0 ? moreReasonWF[moreReasonVars.last()] + 1 : 0;
+    if(sets < moreReasonWFBegin.size()) {
+        moreReasonWFLits.shrink_(moreReasonWFLits.size() - moreReasonWFBegin[sets]);
+        moreReasonWFBegin.shrink_(moreReasonWFBegin.size() - sets);
+    }
+
+    // unassigned atoms without source pointer are checked again
+    for(int i = decisionLevel() + 1; i < falseUnfoundedLevels; i++) {
+        for(int j = 0; j < falseUnfounded[i].size(); j++) {
+            int atom = falseUnfounded[i][j];
+            if(sourcePointer[atom] == -1) addUnfounded(atom);
+        }
+        falseUnfounded[i].clear();
+    }
+    if(falseUnfoundedLevels > decisionLevel() + 1) falseUnfoundedLevels = decisionLevel() + 1;
+}
+
+struct AtomOccurrencesGt {
+    const vec<int>& occurrences;
+    AtomOccurrencesGt(const vec<int>& occurrences_) : occurrences(occurrences_) {}
+    bool operator()(Var a, Var b) const { return occurrences[a] > occurrences[b]; }
+};
+
+void AspSolver::clone(AspSolver& other) {
+    assert(decisionLevel() == 0);
+    other.MaxSatSolver::eliminate(true);
+
+    // the trail is copied first and in order, so that positions not yet processed by the unfounded set check are the same
+    while(other.nVars() < nVars()) {
+        Var v = other.nVars();
+        other.newVar();
+        if(isEliminated(v)) other.setDecisionVar(v, false);
+    }
+    for(int i = 0; i < trail.size(); i++) other.addClause(trail[i]);
+    assert(other.trail.size() == trail.size());
+
+    vec<Lit> lits;
+    for(int i = 0; i < clauses.size(); i++) {
+        Clause& clause = ca[clauses[i]];
+        for(int j = 0; j < clause.size(); j++) lits.push(clause[j]);
+        other.addClause_(lits);
+        lits.clear();
+    }
+    for(int i = 0; i < cconstraints.size(); i++) {
+        CardinalityConstraint cc;
+        cconstraints[i]->lits.copyTo(cc.lits);
+        cc.bound = cconstraints[i]->bound;
+        other.addConstraint(cc);
+    }
+    for(int i = 0; i < wconstraints.size(); i++) {
+        WeightConstraint wc;
+        wconstraints[i]->lits.copyTo(wc.lits);
+        wconstraints[i]->coeffs.copyTo(wc.coeffs);
+        wc.bound = wconstraints[i]->bound;
+        other.addConstraint(wc);
+    }
+
+    tag.copyTo(other.tag);
+    other.tagCalls = tagCalls;
+    other.nextToPropagate = nextToPropagate;
+    body.copyTo(other.body);
+    for(int i = 0; i < recBody.size(); i++) { other.recBody.push(); recBody[i].copyTo(other.recBody.last()); }
+    withoutSourcePointer.copyTo(other.withoutSourcePointer);
+    possibleSourcePointerOf.copyTo(other.possibleSourcePointerOf);
+    sourcePointer.copyTo(other.sourcePointer);
+    for(Var v = 0; v < nVars(); v++) {
+        possibleSourcePointers[v].copyTo(other.possibleSourcePointers[v]);
+        for(int i = 0; i < 2; i++) {
+            inBody[i][v].copyTo(other.inBody[i][v]);
+            isBodyOf[i][v].copyTo(other.isBodyOf[i][v]);
+        }
+        inRecBody[v].copyTo(other.inRecBody[v]);
+    }
+    moreReasonWF.copyTo(other.moreReasonWF);
+    moreReasonVars.copyTo(other.moreReasonVars);
+    moreReasonWFLits.copyTo(other.moreReasonWFLits);
+    moreReasonWFBegin.copyTo(other.moreReasonWFBegin);
+    atomComp.copyTo(other.atomComp);
+    other.tight = tight;
+    for(int i = 0; i < compUnfounded.size(); i++) { other.compUnfounded.push(); compUnfounded[i].copyTo(other.compUnfounded.last()); }
+    dirtyComps.copyTo(other.dirtyComps);
+    inUnfounded.copyTo(other.inUnfounded);
+}
+
+void AspSolver::split(vec<Lit>& path, const vec<Var>& order, int depth) {
+    assert(decisionLevel() == path.size());
+    int i = 0;
+    if(depth > 0) while(i < order.size() && value(order[i]) != l_Undef) i++;
+    if(depth == 0 || i == order.size()) {
+        paths.give(path);
+        return;
+    }
+
+    for(int j = 0; j < 2; j++) {
+        Lit q = mkLit(order[i], j == 1);
+        path.push(q);
+        newDecisionLevel();
+        uncheckedEnqueue(q);
+        // a conflict on clauses means that the path has no answer sets
+        if(Glucose::Solver::propagate() == CRef_Undef) split(path, order, depth - 1);
+        cancelUntil(decisionLevel() - 1);
+        path.pop();
+    }
 }
 
+void AspSolver::stopAll() {
+    master->paths.stop();
+    for(int i = 0; i < master->solvers.size(); i++) master->solvers[i]->Glucose::SimpSolver::interrupt();
+}
+
+lbool AspSolver::onPathModel() {
+    Msg msg;
+    for(int i = 0; i < master->shown.size(); i++) if(value(master->shown[i]) == l_True) msg.atoms.push(master->shown[i]);
+    if(master->solvers.size() > 0) master->msgs.push(msg);
+    else {
+        printAnswerSet(msg.atoms);
+        if(nModels == maxModels) return l_False;
+    }
+
+    if(!option_asp_project) return l_True;
+    // the projection is blocked by a clause over shown atoms; no branching literal is kept, so the path is not given away in parts
+    vec<Lit> lits;
+    for(int i = 0; i < master->shown.size(); i++) lits.push(mkLit(master->shown[i], value(master->shown[i]) == l_True));
+    cancelUntil(0);
+    return addClause(lits) ? l_Undef : l_False;
+}
+
+void AspSolver::enumerateWork() {
+    Msg msg;
+    msg.complete = enumeratePaths(master->paths, master->solvers.size());
+    if(!msg.complete) stopAll();
+    msg.done = true;
+    master->msgs.push(msg);
+}
+
+void AspSolver::printAnswerSet(const vec<Var>& atoms) {
+    nModels++;
+    cout << "Answer: " << nModels << endl;
+    for(int i = 0; i < atoms.size(); i++) cout << namemap[atoms[i]] << " ";
+    cout << endl;
+}
+
+lbool AspSolver::enumerate(int n) {
+    assert(master == this);
+    cancelUntil(0);
+    maxModels = n;
+
+    if(ok && option_asp_threads == 1) {
+        for(int i = 0; i < nVars(); i++) if(namemap.has(i)) shown.push(i);
+        vec<Lit> path;
+        enumeratePath(path, NULL);
+    }
+    else if(ok) {
+        for(int i = 0; i < nVars(); i++) if(namemap.has(i)) shown.push(i);
+
+        solvers.push(this);
+        for(int i = 1; i < option_asp_threads; i++) {
+            solvers.push(new AspSolver(this));
+            solvers.last()->id = i;
+            clone(*solvers.last());
+        }
+
+        // guiding paths assign the shown atoms occurring in more clauses first
+        vec<int> occurrences;
+        occurrences.growTo(nVars(), 0);
+        for(int i = 0; i < clauses.size(); i++) {
+            Clause& clause = ca[clauses[i]];
+            for(int j = 0; j < clause.size(); j++) occurrences[var(clause[j])]++;
+        }
+        vec<Var> order;
+        for(int i = 0; i < shown.size(); i++) if(value(shown[i]) == l_Undef) order.push(shown[i]);
+        Glucose::sort(order, AtomOccurrencesGt(occurrences));
+
+        int depth = 4;
+        while((1 << (depth - 4)) < solvers.size()) depth++;
+        vec<Lit> path;
+        split(path, order, depth);
+        assert(decisionLevel() == 0);
+        trace(asp, 1, "Split in " << paths.size() << " guiding paths at depth " << depth);
+
+        vec<std::thread*> threads;
+        for(int i = 0; i < solvers.size(); i++) threads.push(new std::thread(&AspSolver::enumerateWork, solvers[i]));
+
+        // answer sets are printed here only, numbered in the order they arrive
+        int done = 0;
+        Msg msg;
+        while(done < solvers.size()) {
+            if(!msgs.pop(msg)) { msgs.wait(); continue; }
+            if(msg.done) { done++; continue; }
+            if(paths.isStopped()) continue;
+            printAnswerSet(msg.atoms);
+            if(nModels == n) stopAll();
+        }
+        for(int i = 0; i < threads.size(); i++) { threads[i]->join(); delete threads[i]; }
+    }
+
+    if(nModels == 0) cout << "UNSATISFIABLE" << endl;
+    if(option_asp_stats) printStatistics();
+
+    return nModels == 0 ? l_False : l_True;
+}
 
 } // namespace aspino
@@ -19,8 +19,12 @@
 #define __AspSolver_h__
 
 #include "MaxSatSolver.h"
+#include "utils/MsgQueue.h"
+#include "utils/GuidingPaths.h"
 #include "glucose-syrup/mtl/Map.h"
 
+#include <thread>
+
 using Glucose::Map;
 
 namespace aspino {
@@ -51,29 +55,42 @@ public:
 private:
 };
 
+// weighted literals of a minimize statement, or of an aggregate too large to be replaced by normal rules while parsing
 class Sum {
     friend ostream& operator<<(ostream& out, const Sum& sum);
 public:
-    inline Sum() : bound(0), posTrueWeight(0) {}
+    inline Sum() : head(var_Undef), bound(0) {}
     
-    Literal head;
+    Var head;
     vec<Literal> body;
     vec<long> weights;
     long bound;
-    long posTrueWeight;
     
     inline int size() const { return body.size(); }
     inline void shrink(int size) { body.shrink(size); weights.shrink(size); }
+};
+
+// view of a ground rule stored in the arena of AspSolver: simplifications remove literals in place
+class Rule {
+public:
+    inline Rule(Literal* lits_, int& size_) : lits(lits_), sz(size_) {}
+    
+    inline int size() const { return sz; }
+    inline Literal& operator[](int index) { return lits[index]; }
+    inline void shrink(int nelems) { assert(nelems <= sz); sz -= nelems; }
+    inline void clear() { sz = 0; }
     
-    static inline int type2idx(int type) { assert(type == Literal::POS || type == Literal::NEG); return type == Literal::POS ? 0 : 1; }
+private:
+    Literal* lits;
+    int& sz;
 };
 
 class AspSolver : public MaxSatSolver {
 public:
-    AspSolver();
+    AspSolver(AspSolver* master = NULL);
     virtual ~AspSolver();
     
-    virtual void interrupt() { cout << "s UNKNOWN" << endl; this->exit(1); }
+    virtual void interrupt();
     
     virtual void parse(gzFile in);
     
@@ -94,14 +111,32 @@ protected:
     void _moreConflictWF(vec<Lit>& out_learnt, vec<Lit>& selectors, int& pathC);
     
 private:
-    vec<vec<Literal>*> program;
-    vec<Sum*> sums;
+    // ground normal and choice rules: rule i is ruleLits[ruleBegin[i]..ruleBegin[i]+ruleSize[i])
+    vec<Literal> ruleLits;
+    vec<int> ruleBegin;
+    vec<int> ruleSize;
+    inline Rule getRule(int rule) { return Rule((Literal*) ruleLits + ruleBegin[rule], ruleSize[rule]); }
+    // bodies of constraints, as clauses
+    vec<vec<Lit> > constraints;
+    
+    // minimize statements, in input order: the last one has the highest priority
+    vec<Sum*> minimize;
+    int minimizeLevels;
+    
+    // aggregates whose sequential counter would be too large: unless recursive, they become weight constraints on an auxiliary atom
+    vec<Sum*> aggregates;
     
     vec<int> idmap;
     Map<int, string> namemap;
-    vec<vec<vec<Literal>*> > occ[5];
-    vec<Sum*> sumId;
-    vec<vec<Sum*> > sumOcc[2];
+    // rules of each atom by literal type, built after parsing: rules of atom v are occRules[t][occBegin[t][v]..occEnd[t][v])
+    vec<int> occRules[5];
+    vec<int> occBegin[5];
+    vec<int> occEnd[5];
+    inline int occSize(int type, Var v) const { return occEnd[type][v] - occBegin[type][v]; }
+    inline int occRule(int type, Var v, int i) const { return occRules[type][occBegin[type][v] + i]; }
+    // rules with the same body share the literal defining it in the completion: bodyAux[bodyRep[rule]], if already defined
+    vec<int> bodyRep;
+    vec<Lit> bodyAux;
     vec<unsigned> tag;
     unsigned tagCalls;
     
@@ -112,7 +147,6 @@ private:
     
     int nModels;
     
-    vec<vec<Literal>*> recursiveRules;
     vec<Lit> body;
     vec<vec<int> > recBody;
     vec<vec<int> > isBodyOf[2];
@@ -123,17 +157,48 @@ private:
     vec<vec<int> > inBody[2];
     vec<vec<int> > inRecBody;
     vec<int> unfounded;
+
+    // withoutSourcePointer[rec] counts the atoms of recBody[rec] without source pointer, whatever their truth value
+    // recursive component of each atom (-1 for the others), and atoms without source pointer to be checked, by component
+    vec<int> atomComp;
+    vec<vec<int> > compUnfounded;
+    vec<bool> inUnfounded;
+    vec<int> dirtyComps;
+    // false atoms without source pointer, by decision level: they are checked again when unassigned by backtracking
+    vec<vec<int> > falseUnfounded;
+    int falseUnfoundedLevels;
+    // no recursive component after completion: well-founded propagation is skipped, and hooks only run the PB layer
+    bool tight;
     
     vec<int> moreReasonWF;
     vec<Var> moreReasonVars;
-    vec<vec<Lit> > moreReasonWFVec;
+    // reasons of unfounded sets: set i is moreReasonWFLits[moreReasonWFBegin[i]..moreReasonWFEnd(i)), and sets are popped on backtracking
+    vec<Lit> moreReasonWFLits;
+    vec<int> moreReasonWFBegin;
+    inline int moreReasonWFEnd(int set) const { return set + 1 < moreReasonWFBegin.size() ? moreReasonWFBegin[set + 1] : moreReasonWFLits.size(); }
 //    WeightConstraint* moreConflictWC;
 //    Lit moreConflictLit;
     int moreConflictWF;
 
+    // scratch stacks of the unfounded set check
+    vec<int> stackA;
+    vec<int> stackR;
+    vec<int> uSet;
+
+    // statistics of the unfounded set check
+    uint64_t wfChecks;
+    uint64_t wfSets;
+    uint64_t wfInferences;
+    uint64_t wfConflicts;
+    double wfTime;
+    void printStatistics() const;
+
     
-    CRef morePropagate(Lit lit);
-    bool findSourcePointers();
+    void invalidateSourcePointers(Lit lit);
+    void addUnfounded(int atom);
+    void addFalseUnfounded(int atom, int lev);
+    void setSourcePointer(int atom, int rec);
+    bool findSourcePointers(int comp);
     
     int getId(int input_id);
     string getName(int atom) const;
@@ -142,29 +207,76 @@ private:
     void parseChoiceRule(Glucose::StreamBuffer& in);
     void parseCountRule(Glucose::StreamBuffer& in);
     void parseSumRule(Glucose::StreamBuffer& in);
+    void parseMinimizeRule(Glucose::StreamBuffer& in);
     
-    void add(Sum* sum);
+    // var_Undef is the head of constraints
+    void addNormalRule(Var headAtom, const vec<Literal>& lits);
+    void addSumRule(Var headAtom, const vec<Literal>& lits, vec<int64_t>& weights, int64_t bound);
+    void addSumCounter(Var headAtom, const vec<Literal>& lits, const vec<int64_t>& weights, int bound);
+    void translateAggregates();
+    void addAggregates();
+    
+    void buildOccurrences();
+    void removeOcc(int type, Var v, int rule);
 
     void propagate();
     void propagateTrue(Var v);
     void propagateFalse(Var v);
-    void onTrueHead(vec<Literal>& rule, Literal headAtom);
-    void onFalseHead(vec<Literal>& rule, Literal headAtom);
-    void onTrueBody(vec<Literal>& rule, Literal bodyAtom);
-    void onFalseBody(vec<Literal>& rule);
-    void onTrueHead(Sum& rule);
-    void onFalseHead(Sum& rule);
-    void onTrueBody(Sum& rule, Literal lit);
-    void onFalseBody(Sum& rule, Literal lit);
+    void onTrueHead(int ruleId, Literal headAtom);
+    void onFalseHead(int ruleId, Literal headAtom);
+    void onTrueBody(int ruleId, Literal bodyAtom);
+    void onFalseBody(int ruleId);
     
     void finalPropagation();
+    void simplifyProgram();
     void processComponents();
     void completion(Var i, vec<Lit>& supp);
+    void addMinimize();
     void clearParsingStructures();
     
     virtual void onCancel();
     
     bool hasSupportInference(Var atom) const;
+    
+    lbool solveMinimize();
+    // the estimate is refined by one solver call per shown atom at most
+    lbool solveConsequences(bool brave);
+
+    // enumeration without blocking clauses, unless projected on shown atoms.
+    // Parallel enumeration: the master splits the search in guiding paths over shown atoms, and its clones enumerate them.
+    // Answer sets are sent to the master that prints them; idle solvers receive the unexplored branches of busy ones.
+    AspSolver* master;
+    vec<AspSolver*> solvers;
+    int id;
+
+    // master only
+    vec<Var> shown;
+    int maxModels;
+    GuidingPaths paths;
+    void clone(AspSolver& other);
+    void split(vec<Lit>& path, const vec<Var>& order, int depth);
+    void stopAll();
+
+    struct Msg {
+        inline Msg() : done(false), complete(false) {}
+        inline void swap(Msg& other) {
+            std::swap(done, other.done);
+            std::swap(complete, other.complete);
+            vec<Var> tmp;
+            atoms.moveTo(tmp); other.atoms.moveTo(atoms); tmp.moveTo(other.atoms);
+        }
+        vec<Var> atoms; // true shown atoms
+        bool done;      // last message of a solver
+        bool complete;  // the solver enumerated all answer sets of its paths
+    };
+    MsgQueue<Msg> msgs;
+
+    // paths are enumerated by flipping branching literals as assumptions, so no clause is learned from answer sets.
+    // With projection on shown atoms, each projection is blocked by a clause instead, and the path is not split further.
+    virtual lbool onPathModel();
+    void enumerateWork();
+    lbool enumerate(int n);
+    void printAnswerSet(const vec<Var>& atoms);
 };
     
 } // namespace aspino
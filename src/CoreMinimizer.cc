@@ -0,0 +1,183 @@
+/*
+ *  Copyright (C) 2017  Mario Alviano (mario@alviano.net)
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "CoreMinimizer.h"
+
+namespace aspino {
+
+CoreMinimizer::CoreMinimizer(MaxSatSolver& solver_, int n) : solver(solver_), syncedVars(0), syncedTrail(0), syncedCConstraints(0), syncedWConstraints(0), worker(NULL), next(0), quit(false), stopped(false) {
+    assert(n > 0);
+    for(int i = 0; i < n; i++) {
+        helpers.push(new MaxSatSolver(true));
+        helpers.last()->sortAssumptions = false;
+    }
+    worker = new std::thread(&CoreMinimizer::work, this);
+}
+
+CoreMinimizer::~CoreMinimizer() {
+    std::unique_lock<std::mutex> locker(lock);
+    quit = true;
+    stopped = true;
+    for(int i = 0; i < helpers.size(); i++) helpers[i]->asynch_interrupt = true;
+    locker.unlock();
+    changed.notify_all();
+    worker->join();
+    delete worker;
+    for(int i = 0; i < pending.size(); i++) delete pending[i];
+    for(int i = 0; i < helpers.size(); i++) delete helpers[i];
+}
+
+void CoreMinimizer::sync() {
+    assert(solver.decisionLevel() == 0);
+    assert(next == pending.size());
+
+    Var vars = syncedVars;
+    vec<Lit> lits;
+    for(int i = 0; i < helpers.size(); i++) {
+        MaxSatSolver& helper = *helpers[i];
+        assert(helper.decisionLevel() == 0);
+        while(helper.nVars() < solver.nVars()) {
+            Var v = helper.nVars();
+            helper.newVar();
+            if(solver.isEliminated(v)) helper.setDecisionVar(v, false);
+        }
+
+        for(int j = syncedTrail; j < solver.trail.size(); j++)
+            if(helper.value(solver.trail[j]) == l_Undef) helper.addClause(solver.trail[j]);
+
+        // clauses added by the solver after the last call introduce new variables; the others are units, in the trail
+        for(int j = 0; j < solver.clauses.size(); j++) {
+            Clause& clause = solver.ca[solver.clauses[j]];
+            int k = 0;
+            for(; k < clause.size(); k++) if(var(clause[k]) >= vars) break;
+            if(k == clause.size()) continue;
+            for(k = 0; k < clause.size(); k++) lits.push(clause[k]);
+            helper.addClause_(lits);
+            lits.clear();
+        }
+
+        for(int j = syncedCConstraints; j < solver.cconstraints.size(); j++) {
+            CardinalityConstraint cc;
+            solver.cconstraints[j]->lits.copyTo(cc.lits);
+            cc.bound = solver.cconstraints[j]->bound;
+            helper.addConstraint(cc);
+        }
+        for(int j = syncedWConstraints; j < solver.wconstraints.size(); j++) {
+            WeightConstraint wc;
+            solver.wconstraints[j]->lits.copyTo(wc.lits);
+            solver.wconstraints[j]->coeffs.copyTo(wc.coeffs);
+            wc.bound = solver.wconstraints[j]->bound;
+            helper.addConstraint(wc);
+        }
+    }
+
+    syncedVars = solver.nVars();
+    syncedTrail = solver.trail.size();
+    syncedCConstraints = solver.cconstraints.size();
+    syncedWConstraints = solver.wconstraints.size();
+}
+
+void CoreMinimizer::check(int i, uint64_t budget) {
+    MaxSatSolver& helper = *helpers[i];
+    helper.setConfBudget(budget);
+    helper.PseudoBooleanSolver::solve();
+    helper.budgetOff();
+    helper.cancelUntil(0);
+}
+
+void CoreMinimizer::minimize(vec<Lit>& core, uint64_t budget) {
+    const int n = helpers.size();
+    int chunks = n;
+    vec<std::thread*> threads;
+    while(core.size() > 1 && !stopped) {
+        if(chunks > core.size()) chunks = core.size();
+
+        // helper i checks the core without chunk first + i; the best result of a round is taken before the next round
+        int best = -1;
+        for(int first = 0; first < chunks && best == -1; first += n) {
+            int k = chunks - first < n ? chunks - first : n;
+            for(int i = 0; i < k; i++) {
+                int begin = static_cast<int64_t>(core.size()) * (first + i) / chunks;
+                int end = static_cast<int64_t>(core.size()) * (first + i + 1) / chunks;
+                vec<Lit>& assumptions = helpers[i]->assumptions;
+                assumptions.clear();
+                for(int j = 0; j < core.size(); j++) if(j < begin || j >= end) assumptions.push(~core[j]);
+            }
+            for(int i = 1; i < k; i++) threads.push(new std::thread(&CoreMinimizer::check, this, i, budget));
+            check(0, budget);
+            for(int i = 0; i < threads.size(); i++) { threads[i]->join(); delete threads[i]; }
+            threads.clear();
+
+            for(int i = 0; i < k; i++) {
+                if(helpers[i]->status != l_False || helpers[i]->conflict.size() == 0) continue;
+                if(best == -1 || helpers[i]->conflict.size() < helpers[best]->conflict.size()) best = i;
+            }
+        }
+
+        if(best != -1) {
+            trace(maxsat, 15, "Minimize: reduce to size " << helpers[best]->conflict.size() << " with " << chunks << " chunks");
+            helpers[best]->conflict.copyTo(core);
+            continue;
+        }
+        // all literals are necessary, at least within the budget
+        if(chunks == core.size()) break;
+        chunks = 2 * chunks < core.size() ? 2 * chunks : core.size();
+    }
+}
+
+void CoreMinimizer::push(vec<Lit>& core, uint64_t budget) {
+    std::unique_lock<std::mutex> locker(lock);
+    pending.push(new vec<Lit>());
+    core.moveTo(*pending.last());
+    pendingBudgets.push(budget);
+    locker.unlock();
+    changed.notify_all();
+}
+
+void CoreMinimizer::wait(vec<vec<Lit> >& cores) {
+    std::unique_lock<std::mutex> locker(lock);
+    changed.wait(locker, [this](){ return next == pending.size(); });
+    for(int i = 0; i < pending.size(); i++) {
+        cores.push();
+        pending[i]->moveTo(cores.last());
+        delete pending[i];
+    }
+    pending.clear();
+    pendingBudgets.clear();
+    next = 0;
+}
+
+void CoreMinimizer::work() {
+    for(;;) {
+        std::unique_lock<std::mutex> locker(lock);
+        changed.wait(locker, [this](){ return next < pending.size() || quit; });
+        if(quit) return;
+        vec<Lit>* core = pending[next];
+        uint64_t budget = pendingBudgets[next];
+        locker.unlock();
+
+        trace(maxsat, 10, "Minimize core of size " << core->size() << " in background");
+        minimize(*core, budget);
+
+        locker.lock();
+        next++;
+        locker.unlock();
+        changed.notify_all();
+    }
+}
+
+} // namespace aspino
@@ -0,0 +1,72 @@
+/*
+ *  Copyright (C) 2017  Mario Alviano (mario@alviano.net)
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef __CoreMinimizer_h__
+#define __CoreMinimizer_h__
+
+#include "MaxSatSolver.h"
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace aspino {
+
+// Minimization of unsatisfiable cores of a MaxSatSolver by helper clones running in threads.
+// The core is split in chunks, and each helper checks the core without one chunk; the smallest core found replaces the current one.
+// Cores can also be minimized in background, while the solver searches for other cores disjoint from them.
+class CoreMinimizer {
+public:
+    CoreMinimizer(MaxSatSolver& solver, int helpers);
+    ~CoreMinimizer();
+
+    // copy in the helpers what the solver added since the last call; the solver is at level 0, and nothing is being minimized
+    void sync();
+
+    void minimize(vec<Lit>& core, uint64_t budget);
+
+    // background minimization: cores are processed in order, and wait() returns all of them when they are minimized
+    void push(vec<Lit>& core, uint64_t budget);
+    void wait(vec<vec<Lit> >& cores);
+
+private:
+    MaxSatSolver& solver;
+    vec<MaxSatSolver*> helpers;
+
+    // part of the solver already copied in the helpers
+    Var syncedVars;
+    int syncedTrail;
+    int syncedCConstraints;
+    int syncedWConstraints;
+
+    std::thread* worker;
+    std::mutex lock;
+    std::condition_variable changed;
+    vec<vec<Lit>*> pending;
+    vec<uint64_t> pendingBudgets;
+    int next;
+    bool quit;
+    std::atomic<bool> stopped;
+    void work();
+
+    void check(int helper, uint64_t budget);
+};
+
+} // namespace aspino
+
+#endif
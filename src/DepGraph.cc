@@ -29,51 +29,95 @@ using std::endl;
 
 namespace aspino {
 
-class AdjacencyList: public boost::adjacency_list<>
-{
-};
-
 DepGraph::DepGraph()
-: arcs(*new AdjacencyList()) {
+: nodes(0) {
 }
 
 DepGraph::~DepGraph() {
-    delete &arcs;
 }
 
 void DepGraph::add(int node) {
     assert(node >= 0);
-    boost::add_edge(node + 1, 0, arcs);
+    if(node >= nodes) nodes = node + 1;
 }
 
 void DepGraph::add(int from, int to) {
     assert(from != to);
     assert(from >= 0);
     assert(to >= 0);
-    boost::add_edge(from + 1, to + 1, arcs);
+    add(from);
+    add(to);
+    arcs.push(from);
+    arcs.push(to);
 }
 
 void DepGraph::sccs(vec<int>& atom2comp, vec<vec<int> >& components, bool& tight) {
-    vector<int> sccs(boost::num_vertices(arcs)), discover_time(boost::num_vertices(arcs));
-    vector<boost::default_color_type> color(boost::num_vertices(arcs));
-    vector<boost::graph_traits<boost::adjacency_list<> >::vertex_descriptor> root(boost::num_vertices(arcs));
-    int n = boost::strong_components(arcs, &sccs[0] , boost::root_map(&root[0]).color_map(&color[0]).discover_time_map(&discover_time[0]));
-
+    assert(atom2comp.size() >= nodes);
+    
+    // compressed sparse rows: the successors of node i are succ[first[i]..first[i+1]), in insertion order
+    vec<int> first(nodes + 1, 0);
+    for(int i = 0; i < arcs.size(); i += 2) first[arcs[i] + 1]++;
+    for(int i = 0; i < nodes; i++) first[i + 1] += first[i];
+    vec<int> succ(arcs.size() / 2);
+    {
+        vec<int> next;
+        first.copyTo(next);
+        for(int i = 0; i < arcs.size(); i += 2) succ[next[arcs[i]]++] = arcs[i + 1];
+    }
+    { vec<int> tmp; arcs.moveTo(tmp); }
+    
+    // index[i] == -1 for unvisited nodes; atom2comp[i] == -1 for nodes still on the stack
+    vec<int> index(nodes, -1);
+    vec<int> low(nodes);
+    vec<int> pos(nodes);
+    vec<int> stack;
+    vec<int> calls;
+    for(int i = 0; i < nodes; i++) atom2comp[i] = -1;
+    
     tight = true;
     components.clear();
-    if(n == 0) return;
-    components.growTo(n-1);
-    
-    assert(sccs[0] == 0);
-    for(int i = 1; i < static_cast<int>(sccs.size()); i++) {
-        int scc = sccs[i] - 1;
-        assert(scc >= 0);
-        assert(scc < components.size());
+    int count = 0;
+    for(int root = 0; root < nodes; root++) {
+        if(index[root] != -1) continue;
+        
+        index[root] = low[root] = count++;
+        pos[root] = first[root];
+        stack.push(root);
+        calls.push(root);
+        while(calls.size() > 0) {
+            int v = calls.last();
+            if(pos[v] < first[v + 1]) {
+                int w = succ[pos[v]++];
+                if(index[w] == -1) {
+                    index[w] = low[w] = count++;
+                    pos[w] = first[w];
+                    stack.push(w);
+                    calls.push(w);
+                }
+                else if(atom2comp[w] == -1 && index[w] < low[v]) low[v] = index[w];
+                continue;
+            }
+            
+            calls.pop();
+            if(calls.size() > 0 && low[v] < low[calls.last()]) low[calls.last()] = low[v];
+            if(low[v] != index[v]) continue;
+            
+            int w;
+            do {
+                w = stack.last();
+                stack.pop();
+                atom2comp[w] = components.size();
+            }while(w != v);
+            components.push();
+        }
+    }
     
-        atom2comp[i-1] = scc;
-        components[scc].push(i-1);
-        if(components[scc].size() > 1) tight = false;
-    }    
+    // nodes of a component are sorted
+    for(int i = 0; i < nodes; i++) {
+        vec<int>& c = components[atom2comp[i]];
+        c.push(i);
+        if(c.size() > 1) tight = false;
+    }
 }
 
 
@@ -24,9 +24,10 @@ using Glucose::vec;
 
 namespace aspino {
 
-class AdjacencyList;
 class WeightedAdjacencyList;
 
+// Arcs are collected in a flat array, and converted in compressed sparse rows when components are computed.
+// Components are numbered in the order they are completed by (iterative) Tarjan's algorithm, so reached components come first.
 class DepGraph {
 public:
     DepGraph();
@@ -37,7 +38,8 @@ public:
     void sccs(vec<int>& atom2comp, vec<vec<int> >& components, bool& tight);
     
 private:
-    AdjacencyList& arcs;
+    int nodes;
+    vec<int> arcs; // pairs from, to
 };
 
 class UndirectedWeightedGraph {
@@ -169,8 +169,11 @@ void FairSatSolver::parse(gzFile in_) {
 }
 
 void FairSatSolver::interrupt() { 
-    cout << "s UNKNOWN" << endl;
-    if(lowerbound != -1 && option_fairsat_printmodel) printModel();
+    if(lowerbound == -1) cout << "s UNKNOWN" << endl;
+    else {
+        cout << "s SATISFIABLE" << endl;
+        if(option_fairsat_printmodel) printModel();
+    }
     this->exit(1);
 }
 
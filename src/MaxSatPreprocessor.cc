@@ -0,0 +1,474 @@
+/*
+ *  Copyright (C) 2017  Mario Alviano (mario@alviano.net)
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "MaxSatPreprocessor.h"
+
+#include "DepGraph.h"
+
+Glucose::IntOption option_maxsat_pre_occlimit("MAXSAT", "maxsat-pre-occ-limit", "Skip preprocessing steps involving literals with more occurrences than this limit.", 100, Glucose::IntRange(0, INT32_MAX));
+Glucose::IntOption option_maxsat_pre_reslimit("MAXSAT", "maxsat-pre-res-limit", "Do not eliminate variables producing resolvents longer than this limit.", 20, Glucose::IntRange(0, INT32_MAX));
+
+namespace aspino {
+
+MaxSatPreprocessor::MaxSatPreprocessor(MaxSatSolver& solver_)
+: solver(solver_), queueHead(0), markValue(0), removedClauses(0), eliminatedVars(0), substitutedVars(0), hardenedLabels(0), matchedLabels(0) {
+}
+
+MaxSatPreprocessor::~MaxSatPreprocessor() {
+}
+
+void MaxSatPreprocessor::run() {
+    assert(solver.decisionLevel() == 0);
+
+    trace(maxsat, 20, "Preprocessing: build occurrence lists");
+    init();
+
+    trace(maxsat, 20, "Preprocessing: equivalent literal substitution");
+    substituteEquivalentLiterals();
+    if(!solver.ok) return;
+
+    trace(maxsat, 20, "Preprocessing: blocked clause and variable elimination");
+    eliminate();
+    if(!solver.ok) return;
+
+    // label simplifications ignore constraints enforcing the optimum of previous levels
+    if(!solver.lexicographic) {
+        trace(maxsat, 20, "Preprocessing: subsumed label elimination");
+        subsumedLabelElimination();
+        if(!solver.ok) return;
+
+        trace(maxsat, 20, "Preprocessing: label matching");
+        labelMatching();
+        if(!solver.ok) return;
+    }
+
+    eliminate();
+    if(!solver.ok) return;
+
+    cleanUp();
+    trace(maxsat, 10, "Preprocessing: " << removedClauses << " blocked clauses; " << eliminatedVars << " eliminated variables; " << substitutedVars << " substituted variables; " << hardenedLabels << " hardened labels; " << matchedLabels << " matched labels");
+}
+
+void MaxSatPreprocessor::init() {
+    int n = solver.nVars();
+    occs.growTo(2*n);
+    marks.growTo(2*n, 0);
+    labels.growTo(n, lit_Undef);
+    frozen.growTo(n, false);
+    eliminated.growTo(n, false);
+    inQueue.growTo(n, false);
+
+    for(int i = 0; i < solver.softLiterals.size(); i++) {
+        Lit soft = solver.softLiterals[i];
+        if(solver.weights[var(soft)] == 0) continue;
+        labels[var(soft)] = ~soft;
+        frozen[var(soft)] = true;
+    }
+    for(int i = 0; i < n; i++) if(solver.frozen[i] || solver.isEliminated(i)) frozen[i] = true;
+    for(int i = 0; i < solver.cconstraints.size(); i++) {
+        CardinalityConstraint& cc = *solver.cconstraints[i];
+        for(int j = 0; j < cc.size(); j++) frozen[var(cc.lits[j])] = true;
+    }
+    for(int i = 0; i < solver.wconstraints.size(); i++) {
+        WeightConstraint& wc = *solver.wconstraints[i];
+        for(int j = 0; j < wc.size(); j++) frozen[var(wc.lits[j])] = true;
+    }
+
+    for(int i = 0; i < solver.clauses.size(); i++) {
+        CRef cr = solver.clauses[i];
+        if(!live(cr)) continue;
+        const Clause& clause = solver.ca[cr];
+        for(int j = 0; j < clause.size(); j++)
+            if(solver.value(clause[j]) == l_Undef) occs[toInt(clause[j])].push(cr);
+    }
+
+    for(int i = 0; i < n; i++) touch(i);
+}
+
+void MaxSatPreprocessor::cleanUp() {
+    int j = 0;
+    for(int i = 0; i < solver.clauses.size(); i++) {
+        if(solver.ca[solver.clauses[i]].mark() == 1) continue;
+        solver.clauses[j++] = solver.clauses[i];
+    }
+    solver.clauses.shrink_(solver.clauses.size() - j);
+
+    j = 0;
+    for(int i = 0; i < solver.softLiterals.size(); i++) {
+        if(solver.weights[var(solver.softLiterals[i])] == 0) continue;
+        solver.softLiterals[j++] = solver.softLiterals[i];
+    }
+    solver.softLiterals.shrink_(solver.softLiterals.size() - j);
+}
+
+bool MaxSatPreprocessor::isPureLabel(Var v) {
+    if(!isLabel(v) || solver.value(v) != l_Undef) return false;
+    vec<CRef>& occ = occs[toInt(~labels[v])];
+    for(int i = 0; i < occ.size(); i++) if(live(occ[i])) return false;
+    return true;
+}
+
+bool MaxSatPreprocessor::live(CRef cr) {
+    const Clause& clause = solver.ca[cr];
+    if(clause.mark() == 1) return false;
+    for(int i = 0; i < clause.size(); i++) {
+        if(solver.value(clause[i]) == l_True) {
+            solver.removeClause(cr);
+            return false;
+        }
+    }
+    return true;
+}
+
+void MaxSatPreprocessor::liveOcc(Lit lit, vec<CRef>& out) {
+    out.clear();
+    vec<CRef>& occ = occs[toInt(lit)];
+    int j = 0;
+    for(int i = 0; i < occ.size(); i++) {
+        if(!live(occ[i])) continue;
+        occ[j++] = occ[i];
+        out.push(occ[i]);
+    }
+    occ.shrink_(occ.size() - j);
+}
+
+void MaxSatPreprocessor::touch(Var v) {
+    if(inQueue[v]) return;
+    inQueue[v] = true;
+    queue.push(v);
+}
+
+void MaxSatPreprocessor::touch(const Clause& clause) {
+    for(int i = 0; i < clause.size(); i++) touch(var(clause[i]));
+}
+
+bool MaxSatPreprocessor::addClause(vec<Lit>& lits) {
+    int n = solver.clauses.size();
+    if(!solver.addClause_(lits)) return false;
+    if(solver.clauses.size() == n) return true;
+
+    CRef cr = solver.clauses.last();
+    const Clause& clause = solver.ca[cr];
+    for(int i = 0; i < clause.size(); i++) occs[toInt(clause[i])].push(cr);
+    touch(clause);
+    return true;
+}
+
+void MaxSatPreprocessor::removeClause(CRef cr) {
+    touch(solver.ca[cr]);
+    solver.removeClause(cr);
+}
+
+void MaxSatPreprocessor::pushElimClause(const Clause& clause, Lit first) {
+    vec<uint32_t>& elimclauses = solver.elimclauses;
+    int pos = elimclauses.size();
+    for(int i = 0; i < clause.size(); i++) {
+        elimclauses.push(toInt(clause[i]));
+        if(clause[i] == first) {
+            elimclauses.last() = elimclauses[pos];
+            elimclauses[pos] = toInt(first);
+        }
+    }
+    assert(elimclauses[pos] == static_cast<uint32_t>(toInt(first)));
+    elimclauses.push(clause.size());
+}
+
+void MaxSatPreprocessor::pushElimClause(Lit first, Lit second) {
+    vec<uint32_t>& elimclauses = solver.elimclauses;
+    elimclauses.push(toInt(first));
+    if(second == lit_Undef) { elimclauses.push(1); return; }
+    elimclauses.push(toInt(second));
+    elimclauses.push(2);
+}
+
+bool MaxSatPreprocessor::blocked(CRef cr, Lit lit) {
+    const Clause& clause = solver.ca[cr];
+    markValue++;
+    for(int i = 0; i < clause.size(); i++) marks[toInt(clause[i])] = markValue;
+
+    vec<CRef>& occ = occs[toInt(~lit)];
+    for(int i = 0; i < occ.size(); i++) {
+        if(!live(occ[i])) continue;
+        const Clause& other = solver.ca[occ[i]];
+        int j = 0;
+        for(; j < other.size(); j++) {
+            if(other[j] == ~lit || solver.value(other[j]) == l_False) continue;
+            if(marks[toInt(~other[j])] == markValue) break;
+        }
+        if(j == other.size()) return false;
+    }
+    return true;
+}
+
+bool MaxSatPreprocessor::resolve(const Clause& a, const Clause& b, Var v, vec<Lit>& out) {
+    out.clear();
+    markValue++;
+    for(int i = 0; i < a.size(); i++) {
+        if(var(a[i]) == v || solver.value(a[i]) == l_False) continue;
+        marks[toInt(a[i])] = markValue;
+        out.push(a[i]);
+    }
+    for(int i = 0; i < b.size(); i++) {
+        if(var(b[i]) == v || solver.value(b[i]) == l_False) continue;
+        if(marks[toInt(~b[i])] == markValue) return false;
+        if(marks[toInt(b[i])] == markValue) continue;
+        out.push(b[i]);
+    }
+    return true;
+}
+
+bool MaxSatPreprocessor::eliminateVar(Var v) {
+    vec<CRef> pos, neg;
+    liveOcc(mkLit(v), pos);
+    liveOcc(~mkLit(v), neg);
+    if(pos.size() == 0 && neg.size() == 0) return false;
+    if(pos.size() + neg.size() > option_maxsat_pre_occlimit) return false;
+
+    vec<Lit> resolvents;
+    vec<int> sizes;
+    for(int i = 0; i < pos.size(); i++) {
+        for(int j = 0; j < neg.size(); j++) {
+            if(!resolve(solver.ca[pos[i]], solver.ca[neg[j]], v, resolvent)) continue;
+            if(sizes.size() == pos.size() + neg.size() || resolvent.size() > option_maxsat_pre_reslimit) return false;
+            for(int k = 0; k < resolvent.size(); k++) resolvents.push(resolvent[k]);
+            sizes.push(resolvent.size());
+        }
+    }
+
+    trace(maxsat, 30, "Preprocessing: eliminate variable " << v + 1 << " (" << pos.size() << " + " << neg.size() << " clauses replaced by " << sizes.size() << " resolvents)");
+    if(pos.size() > neg.size()) {
+        for(int i = 0; i < neg.size(); i++) pushElimClause(solver.ca[neg[i]], ~mkLit(v));
+        pushElimClause(mkLit(v));
+    }
+    else {
+        for(int i = 0; i < pos.size(); i++) pushElimClause(solver.ca[pos[i]], mkLit(v));
+        pushElimClause(~mkLit(v));
+    }
+    for(int i = 0; i < pos.size(); i++) removeClause(pos[i]);
+    for(int i = 0; i < neg.size(); i++) removeClause(neg[i]);
+
+    eliminated[v] = true;
+    solver.setDecisionVar(v, false);
+    eliminatedVars++;
+
+    for(int i = 0, k = 0; i < sizes.size(); i++) {
+        resolvent.clear();
+        for(int j = 0; j < sizes[i]; j++) resolvent.push(resolvents[k++]);
+        if(!addClause(resolvent)) return true;
+    }
+    return true;
+}
+
+void MaxSatPreprocessor::eliminate() {
+    vec<CRef> occ;
+    while(queueHead < queue.size()) {
+        Var v = queue[queueHead++];
+        inQueue[v] = false;
+        if(queueHead == queue.size()) { queue.clear(); queueHead = 0; }
+        if(frozen[v] || eliminated[v] || solver.value(v) != l_Undef) continue;
+
+        for(int s = 0; s < 2; s++) {
+            Lit lit = mkLit(v, s);
+            if(occs[toInt(~lit)].size() > option_maxsat_pre_occlimit) continue;
+            liveOcc(lit, occ);
+            for(int i = 0; i < occ.size(); i++) {
+                if(!live(occ[i]) || !blocked(occ[i], lit)) continue;
+                trace(maxsat, 30, "Preprocessing: remove clause blocked on " << lit);
+                pushElimClause(solver.ca[occ[i]], lit);
+                removeClause(occ[i]);
+                removedClauses++;
+            }
+        }
+
+        eliminateVar(v);
+        if(!solver.ok) return;
+    }
+}
+
+void MaxSatPreprocessor::substituteEquivalentLiterals() {
+    int n = solver.nVars();
+    DepGraph dg;
+    for(int i = 0; i < 2*n; i++) dg.add(i);
+
+    bool binaries = false;
+    for(int i = 0; i < solver.clauses.size(); i++) {
+        CRef cr = solver.clauses[i];
+        if(!live(cr)) continue;
+        const Clause& clause = solver.ca[cr];
+        Lit lits[2];
+        int count = 0;
+        for(int j = 0; j < clause.size(); j++) {
+            if(solver.value(clause[j]) == l_False) continue;
+            if(count == 2) { count++; break; }
+            lits[count++] = clause[j];
+        }
+        if(count != 2) continue;
+        dg.add(toInt(~lits[0]), toInt(lits[1]));
+        dg.add(toInt(~lits[1]), toInt(lits[0]));
+        binaries = true;
+    }
+    if(!binaries) return;
+
+    vec<int> lit2comp(2*n);
+    vec<vec<int> > components;
+    bool tight;
+    dg.sccs(lit2comp, components, tight);
+    if(tight) return;
+
+    // representative: frozen variables first, then smaller indices; the choice is symmetric for complementary components
+    vec<Lit> repr(components.size(), lit_Undef);
+    for(int i = 0; i < components.size(); i++) {
+        vec<int>& component = components[i];
+        if(component.size() == 1) continue;
+        for(int j = 0; j < component.size(); j++) {
+            Lit lit = Glucose::toLit(component[j]);
+            if(lit2comp[toInt(~lit)] == i) {
+                trace(maxsat, 10, "Preprocessing: " << lit << " is equivalent to its complement");
+                solver.ok = false;
+                return;
+            }
+            if(repr[i] == lit_Undef || frozen[var(lit)] > frozen[var(repr[i])] || (frozen[var(lit)] == frozen[var(repr[i])] && var(lit) < var(repr[i]))) repr[i] = lit;
+        }
+    }
+
+    for(int i = 0; i < n; i++) {
+        if(frozen[i] || eliminated[i] || solver.value(i) != l_Undef) continue;
+        Lit r = repr[lit2comp[toInt(mkLit(i))]];
+        if(r == lit_Undef || var(r) == i) continue;
+        substitute(i, r);
+        if(!solver.ok) return;
+    }
+}
+
+void MaxSatPreprocessor::substitute(Var v, Lit repr) {
+    trace(maxsat, 30, "Preprocessing: substitute " << mkLit(v) << " with " << repr);
+    vec<CRef> occ;
+    vec<Lit> lits;
+    for(int s = 0; s < 2; s++) {
+        Lit lit = mkLit(v, s);
+        liveOcc(lit, occ);
+        for(int i = 0; i < occ.size(); i++) {
+            if(!live(occ[i])) continue;
+            const Clause& clause = solver.ca[occ[i]];
+            lits.clear();
+            for(int j = 0; j < clause.size(); j++) lits.push(clause[j] == lit ? repr ^ s : clause[j]);
+            removeClause(occ[i]);
+            if(!addClause(lits)) return;
+        }
+    }
+
+    pushElimClause(mkLit(v), ~repr);
+    pushElimClause(~mkLit(v), repr);
+
+    eliminated[v] = true;
+    solver.setDecisionVar(v, false);
+    substitutedVars++;
+}
+
+void MaxSatPreprocessor::subsumedLabelElimination() {
+    vec<CRef> occ;
+    for(int i = 0; i < solver.softLiterals.size(); i++) {
+        Var v = var(solver.softLiterals[i]);
+        if(!isPureLabel(v)) continue;
+        Lit b = labels[v];
+        liveOcc(b, occ);
+        if(occ.size() > option_maxsat_pre_occlimit) continue;
+
+        // the label is subsumed by any label of lower or equal weight occurring in all of its clauses
+        Lit subsumer = lit_Undef;
+        if(occ.size() > 0) {
+            int min = 0;
+            for(int j = 1; j < occ.size(); j++) if(solver.ca[occ[j]].size() < solver.ca[occ[min]].size()) min = j;
+            const Clause& clause = solver.ca[occ[min]];
+            for(int j = 0; j < clause.size() && subsumer == lit_Undef; j++) {
+                Lit q = clause[j];
+                if(var(q) == v || labels[var(q)] != q || solver.weights[var(q)] > solver.weights[v] || !isPureLabel(var(q))) continue;
+                int k = 0;
+                for(; k < occ.size(); k++) {
+                    const Clause& other = solver.ca[occ[k]];
+                    int h = 0;
+                    while(h < other.size() && other[h] != q) h++;
+                    if(h == other.size()) break;
+                }
+                if(k == occ.size()) subsumer = q;
+            }
+            if(subsumer == lit_Undef) continue;
+        }
+
+        trace(maxsat, 30, "Preprocessing: harden " << ~b << " of weight " << solver.weights[v] << (subsumer == lit_Undef ? " (unused label)" : " (subsumed label)"));
+        solver.weights[v] = 0;
+        hardenedLabels++;
+        touch(v);
+        if(!solver.addClause(~b)) return;
+    }
+}
+
+void MaxSatPreprocessor::labelMatching() {
+    vec<bool> matched(solver.nVars(), false);
+    vec<CRef> occ;
+    for(int i = 0; i < solver.softLiterals.size(); i++) {
+        Var v = var(solver.softLiterals[i]);
+        if(v < solver.nInVars() || matched[v] || !isPureLabel(v)) continue;
+        Lit b = labels[v];
+        liveOcc(b, occ);
+        if(occ.size() != 1) continue;
+        const Clause& clause = solver.ca[occ[0]];
+
+        // another label of the same weight whose only clause clashes with the clause of b: at most one of them can be falsified
+        CRef match = CRef_Undef;
+        Lit q = lit_Undef;
+        for(int j = 0; j < clause.size() && match == CRef_Undef; j++) {
+            if(clause[j] == b || solver.value(clause[j]) != l_Undef) continue;
+            vec<CRef>& other = occs[toInt(~clause[j])];
+            if(other.size() > option_maxsat_pre_occlimit) continue;
+            for(int k = 0; k < other.size() && match == CRef_Undef; k++) {
+                if(!live(other[k])) continue;
+                const Clause& c = solver.ca[other[k]];
+                for(int h = 0; h < c.size(); h++) {
+                    Var u = var(c[h]);
+                    if(u == v || u < solver.nInVars() || matched[u] || labels[u] != c[h] || solver.weights[u] != solver.weights[v] || !isPureLabel(u)) continue;
+                    int count = 0;
+                    vec<CRef>& uocc = occs[toInt(c[h])];
+                    for(int l = 0; l < uocc.size(); l++) if(live(uocc[l])) count++;
+                    if(count != 1) continue;
+                    match = other[k];
+                    q = c[h];
+                    break;
+                }
+            }
+        }
+        if(match == CRef_Undef) continue;
+
+        trace(maxsat, 30, "Preprocessing: match label " << q << " with " << b);
+        matched[v] = matched[var(q)] = true;
+        vec<Lit> lits;
+        const Clause& c = solver.ca[match];
+        for(int j = 0; j < c.size(); j++) lits.push(c[j] == q ? b : c[j]);
+        // in the reconstructed model, q is true only if required by its clause, and b is false in that case
+        pushElimClause(~b, ~q);
+        pushElimClause(c, q);
+        pushElimClause(~q);
+        removeClause(match);
+        solver.weights[var(q)] = 0;
+        eliminated[var(q)] = true;
+        solver.setDecisionVar(var(q), false);
+        matchedLabels++;
+        if(!addClause(lits)) return;
+    }
+}
+
+} // namespace aspino
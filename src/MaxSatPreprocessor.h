@@ -0,0 +1,84 @@
+/*
+ *  Copyright (C) 2017  Mario Alviano (mario@alviano.net)
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef __MaxSatPreprocessor_h__
+#define __MaxSatPreprocessor_h__
+
+#include "MaxSatSolver.h"
+
+namespace aspino {
+
+// Simplifications on hard clauses and labels (negated soft literals) of a MaxSatSolver at decision level 0.
+// Removed clauses are pushed on the elimination stack of the solver, so that copyModel() reconstructs them.
+class MaxSatPreprocessor {
+public:
+    MaxSatPreprocessor(MaxSatSolver& solver);
+    ~MaxSatPreprocessor();
+
+    void run();
+
+private:
+    MaxSatSolver& solver;
+
+    vec<vec<CRef> > occs;
+    vec<Lit> labels;
+    vec<bool> frozen;
+    vec<bool> eliminated;
+    vec<Var> queue;
+    vec<bool> inQueue;
+    int queueHead;
+
+    vec<int> marks;
+    int markValue;
+    vec<Lit> resolvent;
+
+    int removedClauses;
+    int eliminatedVars;
+    int substitutedVars;
+    int hardenedLabels;
+    int matchedLabels;
+
+    void init();
+    void cleanUp();
+
+    inline bool isLabel(Var v) const { return labels[v] != lit_Undef && solver.weights[v] != 0; }
+    bool isPureLabel(Var v);
+
+    bool live(CRef cr);
+    void liveOcc(Lit lit, vec<CRef>& out);
+    void touch(Var v);
+    void touch(const Clause& clause);
+    bool addClause(vec<Lit>& lits);
+    void removeClause(CRef cr);
+    void pushElimClause(const Clause& clause, Lit first);
+    void pushElimClause(Lit first, Lit second = lit_Undef);
+
+    bool blocked(CRef cr, Lit lit);
+    bool resolve(const Clause& a, const Clause& b, Var v, vec<Lit>& out);
+    bool eliminateVar(Var v);
+    void eliminate();
+
+    void substituteEquivalentLiterals();
+    void substitute(Var v, Lit repr);
+
+    void subsumedLabelElimination();
+    void labelMatching();
+};
+
+} // namespace aspino
+
+#endif
@@ -16,6 +16,9 @@
  */
 
 #include "MaxSatSolver.h"
+#include "MaxSatPreprocessor.h"
+#include "PortfolioSolver.h"
+#include "CoreMinimizer.h"
 
 #include <mtl/Map.h>
 #include <utils/System.h>
@@ -26,12 +29,16 @@
 using Glucose::Map;
 
 Glucose::EnumOption option_maxsat_strat("MAXSAT", "maxsat-strat", "Set optimization strategy.", "one|one-2|one-neg|one-wc|one-neg-wc|one-pmres|one-pmres-2|pmres|pmres-reverse|pmres-log|pmres-split-conj|kdyn|wone|wone-gcd|wone-remainder");
-Glucose::EnumOption option_maxsat_disjcores("MAXSAT", "maxsat-disjcores", "Set disjunct unsatisfiable cores policy.", "no|pre|all", 1);
+Glucose::EnumOption option_maxsat_disjcores("MAXSAT", "maxsat-disjcores", "Set disjunct unsatisfiable cores policy (wce: delay relaxation of disjoint cores until the stratum is satisfiable).", "no|pre|all|wce", 1);
+
+Glucose::BoolOption option_maxsat_preprocess("MAXSAT", "maxsat-preprocess", "Simplify hard clauses and soft literals before the optimization starts.", true);
 
 Glucose::BoolOption option_maxsat_printmodel("MAXSAT", "maxsat-print-model", "Print optimal model if found.", true);
 
 Glucose::IntOption option_maxsat_tag("MAXSAT", "maxsat-tag", "Parameter for maxsat-strat.", 16, Glucose::IntRange(2, INT32_MAX));
 
+Glucose::IntOption option_maxsat_minimize_threads("MAXSAT", "maxsat-minimize-threads", "Helper threads minimizing unsatisfiable cores in parallel, 0 to minimize them in the main thread.", 0, Glucose::IntRange(0, INT32_MAX));
+
 namespace aspino {
 
 //#include <signal.h>
@@ -49,38 +56,55 @@ namespace aspino {
 //    }
 //}
     
-MaxSatSolver::MaxSatSolver() : lowerbound(0), lastConflict(0), lastPropagation(0), lastCallCpuTime(0.0) /*, timeBudget(0.0)*/ {
-    if(strcmp(option_maxsat_strat, "one") == 0) corestrat = &MaxSatSolver::corestrat_one;
-    else if(strcmp(option_maxsat_strat, "one-2") == 0) corestrat = &MaxSatSolver::corestrat_one_2;
-    else if(strcmp(option_maxsat_strat, "one-neg") == 0) corestrat = &MaxSatSolver::corestrat_one_neg;
-    else if(strcmp(option_maxsat_strat, "one-wc") == 0) corestrat = &MaxSatSolver::corestrat_one_wc;
-    else if(strcmp(option_maxsat_strat, "one-neg-wc") == 0) corestrat = &MaxSatSolver::corestrat_one_neg_wc;
-    else if(strcmp(option_maxsat_strat, "one-pmres") == 0) corestrat = &MaxSatSolver::corestrat_one_pmres;
-    else if(strcmp(option_maxsat_strat, "one-pmres-2") == 0) corestrat = &MaxSatSolver::corestrat_one_pmres_2;
-    else if(strcmp(option_maxsat_strat, "pmres") == 0) corestrat = &MaxSatSolver::corestrat_pmres;
-    else if(strcmp(option_maxsat_strat, "pmres-reverse") == 0) corestrat = &MaxSatSolver::corestrat_pmres_reverse;
-    else if(strcmp(option_maxsat_strat, "pmres-split-conj") == 0) corestrat = &MaxSatSolver::corestrat_pmres_split_conj;
-    else if(strcmp(option_maxsat_strat, "pmres-log") == 0) corestrat = &MaxSatSolver::corestrat_pmreslog;
-    else if(strcmp(option_maxsat_strat, "kdyn") == 0) corestrat = &MaxSatSolver::corestrat_kdyn;
-    else if(strcmp(option_maxsat_strat, "wone") == 0) corestrat = &MaxSatSolver::corestrat_wone;
-    else if(strcmp(option_maxsat_strat, "wone-gcd") == 0) corestrat = &MaxSatSolver::corestrat_wone_gcd;
-    else if(strcmp(option_maxsat_strat, "wone-remainder") == 0) corestrat = &MaxSatSolver::corestrat_wone_remainder;
-    else assert(0);
-    
-    if(strcmp(option_maxsat_disjcores, "no") == 0) disjcores = NO;
-    else if(strcmp(option_maxsat_disjcores, "pre") == 0) disjcores = PRE;
-    else if(strcmp(option_maxsat_disjcores, "all") == 0) disjcores = ALL;
-    else assert(0);
+MaxSatSolver::MaxSatSolver(bool incremental_) : preprocessing(true), quiet(false), upperbound(INT64_MAX), lowerbound(0), lastConflict(0), lastPropagation(0), lastCallCpuTime(0.0) /*, timeBudget(0.0)*/, incremental(incremental_), invalidRelaxation(false), lexicographic(false), levelOffset(0), portfolio(NULL), minimizer(NULL) {
+    setCoreStrategy(option_maxsat_strat);
+    setDisjunctCores(option_maxsat_disjcores);
     
     setIncrementalMode();
+    
+    // clauses can be added at any time, so variable elimination is turned off
+    if(incremental) eliminate(true);
+}
+
+void MaxSatSolver::setCoreStrategy(const char* name) {
+    if(strcmp(name, "one") == 0) corestrat = &MaxSatSolver::corestrat_one;
+    else if(strcmp(name, "one-2") == 0) corestrat = &MaxSatSolver::corestrat_one_2;
+    else if(strcmp(name, "one-neg") == 0) corestrat = &MaxSatSolver::corestrat_one_neg;
+    else if(strcmp(name, "one-wc") == 0) corestrat = &MaxSatSolver::corestrat_one_wc;
+    else if(strcmp(name, "one-neg-wc") == 0) corestrat = &MaxSatSolver::corestrat_one_neg_wc;
+    else if(strcmp(name, "one-pmres") == 0) corestrat = &MaxSatSolver::corestrat_one_pmres;
+    else if(strcmp(name, "one-pmres-2") == 0) corestrat = &MaxSatSolver::corestrat_one_pmres_2;
+    else if(strcmp(name, "pmres") == 0) corestrat = &MaxSatSolver::corestrat_pmres;
+    else if(strcmp(name, "pmres-reverse") == 0) corestrat = &MaxSatSolver::corestrat_pmres_reverse;
+    else if(strcmp(name, "pmres-split-conj") == 0) corestrat = &MaxSatSolver::corestrat_pmres_split_conj;
+    else if(strcmp(name, "pmres-log") == 0) corestrat = &MaxSatSolver::corestrat_pmreslog;
+    else if(strcmp(name, "kdyn") == 0) corestrat = &MaxSatSolver::corestrat_kdyn;
+    else if(strcmp(name, "wone") == 0) corestrat = &MaxSatSolver::corestrat_wone;
+    else if(strcmp(name, "wone-gcd") == 0) corestrat = &MaxSatSolver::corestrat_wone_gcd;
+    else if(strcmp(name, "wone-remainder") == 0) corestrat = &MaxSatSolver::corestrat_wone_remainder;
+    else assert(0);
+}
+
+void MaxSatSolver::setDisjunctCores(const char* name) {
+    if(strcmp(name, "no") == 0) disjcores = NO;
+    else if(strcmp(name, "pre") == 0) disjcores = PRE;
+    else if(strcmp(name, "all") == 0) disjcores = ALL;
+    else if(strcmp(name, "wce") == 0) disjcores = WCE;
+    else assert(0);
 }
 
 MaxSatSolver::~MaxSatSolver() {
+    delete minimizer;
+    for(int i = 0; i < objectives.size(); i++) delete objectives[i];
 }
 
 void MaxSatSolver::interrupt() { 
-    cout << "s UNKNOWN" << endl;
-    if(upperbound != INT64_MAX && option_maxsat_printmodel) printModel();
+    if(portfolio != NULL) { portfolio->interrupt(); return; }
+    if(upperbound == INT64_MAX) cout << "s UNKNOWN" << endl;
+    else {
+        cout << "s SATISFIABLE" << endl;
+        if(option_maxsat_printmodel) printModel();
+    }
     this->exit(1);
 }
 
@@ -98,7 +122,7 @@ void MaxSatSolver::sameSoftVar(Lit soft, int64_t weight) {
         
     if(weights[var(soft)] == weight) {
         updateLowerBound(weight);
-        setFrozen(var(soft), false);
+        if(!lexicographic) setFrozen(var(soft), false);
         softLiterals[pos] = softLiterals[softLiterals.size()-1];
         softLiterals.shrink_(1);
         weights[var(soft)] = 0;
@@ -117,6 +141,7 @@ void MaxSatSolver::sameSoftVar(Lit soft, int64_t weight) {
 
 void MaxSatSolver::addWeightedClause(vec<Lit>& lits, int64_t weight) {
     if(weight == 0) return;
+    while(weights.size() < nVars()) weights.push(0);
 
     Lit soft;
     if(lits.size() == 1)
@@ -140,6 +165,15 @@ void MaxSatSolver::addWeightedClause(vec<Lit>& lits, int64_t weight) {
     weights[var(soft)] = weight;
     setFrozen(var(soft), true);
 }
+
+void MaxSatSolver::addWeightedClause(vec<Lit>& lits, int64_t weight, int64_t priority) {
+    Objective& obj = objective(priority);
+    // variables of soft clauses are added later, so they must survive simplifications
+    for(int i = 0; i < lits.size(); i++) setFrozen(var(lits[i]), true);
+    obj.clauses.push();
+    lits.copyTo(obj.clauses.last());
+    obj.weights.push(weight);
+}
     
 void MaxSatSolver::parse(gzFile in_) {
     Glucose::StreamBuffer in(in_);
@@ -151,6 +185,9 @@ void MaxSatSolver::parse(gzFile in_) {
     vec<Lit> lits;
     int vars = 0;
     int count = 0;
+    bool leveled = false;
+    int64_t priority = 0;
+    bool unleveled = false;
     for(;;) {
         skipWhitespace(in);
         if(*in == EOF) break;
@@ -175,12 +212,19 @@ void MaxSatSolver::parse(gzFile in_) {
         }
         else if(*in == 'c')
             skipLine(in);
+        else if(*in == 'l') {
+            ++in;
+            if(unleveled) cerr << "PARSE ERROR! Soft clauses must follow a level directive." << endl, exit(3);
+            priority = parseLong(in);
+            leveled = true;
+        }
         else {
             count++;
             if(weighted) weight = parseLong(in);
             readClause(in, *this, lits);
             if(weight == top) addClause_(lits);
-            else addWeightedClause(lits, weight);
+            else if(!leveled) { addWeightedClause(lits, weight); unleveled = true; }
+            else addWeightedClause(lits, weight, priority);
         }
     }
     if(count != inClauses)
@@ -189,10 +233,13 @@ void MaxSatSolver::parse(gzFile in_) {
 
 void MaxSatSolver::hardening() {
     cancelUntil(0);
+    if(portfolio != NULL) portfolio->sync(*this);
+    if(incremental) return; // hardened soft literals cannot be restored if the upper bound increases
     int j = 0;
     for(int i = 0; i < softLiterals.size(); i++) {
         int64_t w = weights[var(softLiterals[i])];
-        if(w + lowerbound >= upperbound) {
+        // with other levels to optimize, models of cost equal to the upper bound must be preserved
+        if(w + lowerbound > upperbound || (w + lowerbound == upperbound && !lexicographic)) {
             addClause(softLiterals[i]);
             trace(maxsat, 30, "Hardening of " << softLiterals[i] << " of weight " << w);
             weights[var(softLiterals[i])] = 0;
@@ -229,103 +276,20 @@ int64_t MaxSatSolver::computeNextLimit(int64_t limit) const {
     return next;
 }
 
-bool MaxSatSolver::tautology(Var v, CRef c1, CRef c2) {
-    Clause& a = ca[c1];
-    Clause& b = ca[c2];
-    for(int i = 0; i < a.size(); i++) {
-        if(var(a[i]) == v) continue;
-        for(int j = 0; j < b.size(); j++) {
-            if(var(b[j]) == v) continue;
-            if(var(a[i]) == var(b[j]) && sign(a[i]) != sign(b[j])) { return true; }
-        }
-    }
-    return false;    
-}
-
-void MaxSatSolver::bce() {
-    trace(maxsat, 20, "Preprocessing: bce");
-
-    bool repeat = false;
-//    cout << "AAAA " << clauses.size() << endl;
-    for(;;) {
-        vec<CRef> occ[nVars()][2];
-        int ii = 0;
-        for(int i = 0; i < clauses.size(); i++) {
-            Clause& clause = ca[clauses[i]];
-            if(clause.mark()) continue;
-            clauses[ii++] = clauses[i];
-            for(int j = 0; j < clause.size(); j++) {
-                //count[var(clause[j])][sign(clause[j])]++;
-                occ[var(clause[j])][sign(clause[j])].push(clauses[i]);
-            }
-        }
-        clauses.shrink_(clauses.size()-ii);
-//        cout << "AAAA " << clauses.size() << endl;
-        
-        for(int i = 0; i < nVars(); i++) {
-            if(occ[i][0].size() == 0 && occ[i][1].size() == 0) {
-//                if(weights[i] > 0) cout << "HHH " << i<<endl;
-                weights[i] = 0;
-                continue;
-            }
-            
-            if(occ[i][0].size() == 0 || occ[i][1].size() == 0) {
-                if(weights[i] == 0) { 
-//                    cout << "Pure literal: " << mkLit(i, occ[i][1].size() == 0) << endl; 
-                    addClause(mkLit(i, occ[i][1].size() == 0)); 
-                }
-                else {
-                    for(int j = 0; j < softLiterals.size(); j++) {
-                        if(var(softLiterals[j]) == i) {
-                            if(occ[i][sign(softLiterals[j])] > 0) {
-//                                cout << "Pure literal: " << mkLit(i, occ[i][1].size() == 0) << endl;
-                                addClause(mkLit(i, occ[i][1].size() == 0));
-                                weights[i] = 0;
-                            }
-                            break;
-                        }
-                    }
-                }
-            }
-            
-            
-            for(int s = 0; s <= 1; s++) {
-                if(weights[i] > 0) {
-                    bool skip = false;
-                    for(int j = 0; j < softLiterals.size(); j++) if(var(softLiterals[j]) == i && sign(softLiterals[j]) != s) { skip = true; break; }
-                    if(skip) continue;
-                }
-//                if(occ[i][1-s].size() > 8) continue;
-                for(int j = 0; j < occ[i][s].size(); j++) {
-                    bool ok = true;
-                    for(int k = 0; k < occ[i][1-s].size(); k++) if(!tautology(i, occ[i][s][j], occ[i][1-s][k])) { ok = false; break; }
-                    if(ok) { removeClause(occ[i][s][j]); repeat = true; }
-                }
-            }
-            
-        }
-        if(!repeat) break;
-        repeat = false;
-        
-    }
-}
-
 void MaxSatSolver::preprocess() {
     assert(decisionLevel() == 0);
     if(softLiterals.size() == 0) return;
     trace(maxsat, 10, "Preprocessing");
     
-//    bce();
+    if(option_maxsat_preprocess && preprocessing && !incremental) {
+        MaxSatPreprocessor(*this).run();
+        if(!ok) return;
+        removeSoftLiteralsAtLevelZero();
+    }
     
     trace(maxsat, 20, "Preprocessing: cache signs of soft literals");
     vec<bool> signs(nVars());
-    for(int i = 0; i < softLiterals.size(); i++) {
-        if(weights[var(softLiterals[i])] != weights[var(softLiterals[0])]) {
-            trace(maxsat, 10, "Preprocessing: detected weighted instance; skip preprocessing");
-            return;
-        }
-        signs[var(softLiterals[i])] = sign(softLiterals[i]);
-    }
+    for(int i = 0; i < softLiterals.size(); i++) signs[var(softLiterals[i])] = sign(softLiterals[i]);
     
     trace(maxsat, 20, "Preprocessing: partition clauses by increasing size");
     vec<vec<CRef>*> clausesPartition;
@@ -393,8 +357,26 @@ lbool MaxSatSolver::solve() {
 //    signal(SIGALRM, watchdog);
 //    alarm(1);
 
+    vec<int64_t> optima;
+    if(optimize(optima) == l_False) { cout << "s UNSATISFIABLE" << endl; return l_False; }
+    
+    cout << "o";
+    for(int i = 0; i < optima.size(); i++) cout << " " << optima[i];
+    cout << endl;
+    cout << "s OPTIMUM FOUND" << endl;
+    if(option_maxsat_printmodel) printModel();
+    return l_True;
+}
+
+lbool MaxSatSolver::optimize() {
     inClauses = clauses.size();
     upperbound = INT64_MAX;
+    assumptions.clear();
+    
+    softLiterals.copyTo(levelSoftLiterals);
+    levelWeights.clear();
+    for(int i = 0; i < softLiterals.size(); i++) levelWeights.push(weights[var(softLiterals[i])]);
+    levelOffset = lowerbound;
 
 //    // spend some time to identify easy backbones literals
 //    timeBudget = Glucose::cpuTime() + 10.0;
@@ -403,7 +385,7 @@ lbool MaxSatSolver::solve() {
 //    budgetOff();
 //    clearInterrupt();
 //    timeBudget = 0.0;
-    if(status == l_False) { cout << "s UNSATISFIABLE" << endl; return l_False; }
+    if(status == l_False) return l_False;
     if(status == l_True) updateUpperBound();
     cancelUntil(0);
 
@@ -411,10 +393,14 @@ lbool MaxSatSolver::solve() {
     preprocess();
     hardening();
 
+    // the helpers copy the clauses added by relaxations, so the formula cannot change otherwise
+    if(option_maxsat_minimize_threads > 0 && !incremental && !lexicographic && portfolio == NULL && minimizer == NULL)
+        minimizer = new CoreMinimizer(*this, option_maxsat_minimize_threads);
+
     solve_();
     trace(maxsat, 2, "Bounds: [" << lowerbound << ":" << upperbound << "]");
 
-    if(upperbound == INT64_MAX) { cout << "s UNSATISFIABLE" << endl; return l_False; }
+    if(upperbound == INT64_MAX) return l_False;
         
     if(lowerbound < upperbound) {
         if(!ok) status = l_False;
@@ -434,13 +420,172 @@ lbool MaxSatSolver::solve() {
     
     assert(lowerbound == upperbound);
     assert(upperbound < INT64_MAX);
+    return l_True;
+}
+
+MaxSatSolver::Objective& MaxSatSolver::objective(int64_t priority) {
+    int i = 0;
+    while(i < objectives.size() && objectives[i]->priority < priority) i++;
+    if(i < objectives.size() && objectives[i]->priority == priority) return *objectives[i];
     
-    cout << "o " << lowerbound << endl;
-    cout << "s OPTIMUM FOUND" << endl;
-    if(option_maxsat_printmodel) printModel();
+    lexicographic = true;
+    objectives.push(NULL);
+    for(int j = objectives.size() - 1; j > i; j--) objectives[j] = objectives[j-1];
+    objectives[i] = new Objective();
+    objectives[i]->priority = priority;
+    return *objectives[i];
+}
+
+lbool MaxSatSolver::optimize(vec<int64_t>& optima) {
+    if(objectives.size() == 0) {
+        if(optimize() == l_False) return l_False;
+        optima.push(lowerbound);
+        return l_True;
+    }
+    
+    optimizedLevels.clear();
+    while(objectives.size() > 0) {
+        Objective* obj = objectives.last();
+        objectives.pop();
+        trace(maxsat, 1, "Optimize level " << obj->priority << " with " << obj->clauses.size() << " soft clauses");
+        
+        cancelUntil(0);
+        lowerbound = 0;
+        for(int i = 0; i < obj->clauses.size(); i++) addWeightedClause(obj->clauses[i], obj->weights[i]);
+        delete obj;
+        
+        // the optimum of this level is enforced by a constraint on its soft literals, as weights are modified by cores
+        WeightConstraint wc;
+        int64_t sum = 0;
+        for(int i = 0; i < softLiterals.size(); i++) {
+            wc.lits.push(softLiterals[i]);
+            wc.coeffs.push(weights[var(softLiterals[i])]);
+            sum += wc.coeffs.last();
+        }
+        int64_t offset = lowerbound;
+        
+        if(optimize() == l_False) return l_False;
+        optima.push(lowerbound);
+        optimizedLevels.push(lowerbound);
+        
+        cancelUntil(0);
+        for(int i = 0; i < softLiterals.size(); i++) weights[var(softLiterals[i])] = 0;
+        softLiterals.clear();
+        if(wc.size() == 0) continue;
+        wc.bound = sum - (lowerbound - offset);
+        if(!addConstraint(wc)) return l_False;
+    }
     return l_True;
 }
 
+bool MaxSatSolver::bestCosts(vec<int64_t>& costs) const {
+    costs.clear();
+    if(upperbound == INT64_MAX) return false;
+    
+    // the model satisfies the constraints on the optimized levels, and the soft clauses of the next levels are not added yet
+    optimizedLevels.copyTo(costs);
+    int64_t cost = levelOffset;
+    for(int i = 0; i < levelSoftLiterals.size(); i++) if(modelValue(levelSoftLiterals[i]) == l_False) cost += levelWeights[i];
+    costs.push(cost);
+    for(int i = objectives.size() - 1; i >= 0; i--) {
+        const Objective& obj = *objectives[i];
+        cost = 0;
+        for(int j = 0; j < obj.clauses.size(); j++) {
+            int k = 0;
+            while(k < obj.clauses[j].size() && modelValue(obj.clauses[j][k]) != l_True) k++;
+            if(k == obj.clauses[j].size()) cost += obj.weights[j];
+        }
+        costs.push(cost);
+    }
+    return true;
+}
+
+bool MaxSatSolver::addHardClause(vec<Lit>& lits) {
+    assert(incremental);
+    cancelUntil(0);
+    while(weights.size() < nVars()) weights.push(0);
+    return addClause(lits);
+}
+
+int MaxSatSolver::addSoftClause(vec<Lit>& lits, int64_t weight) {
+    assert(incremental);
+    assert(weight >= 0);
+    cancelUntil(0);
+    softClauses.push();
+    lits.copyTo(softClauses.last());
+    softClauseWeights.push(weight);
+    selectors.push(weight == 0 ? lit_Undef : addSelector(lits, weight));
+    return selectors.size() - 1;
+}
+
+void MaxSatSolver::removeSoftClause(int index) {
+    assert(incremental);
+    assert(0 <= index && index < selectors.size());
+    Lit soft = selectors[index];
+    if(soft == lit_Undef) return;
+    selectors[index] = lit_Undef;
+    
+    // cores involving the soft clause are no longer valid
+    if(weights[var(soft)] != softClauseWeights[index]) { invalidRelaxation = true; return; }
+    
+    cancelUntil(0);
+    weights[var(soft)] = 0;
+    for(int i = 0; i < softLiterals.size(); i++) {
+        if(softLiterals[i] != soft) continue;
+        softLiterals[i] = softLiterals.last();
+        softLiterals.pop();
+        break;
+    }
+}
+
+lbool MaxSatSolver::solve(const vec<Lit>& assumps) {
+    assert(incremental);
+    // variables created since the last call, possibly only for the assumptions, have no weight yet
+    while(weights.size() < nVars()) weights.push(0);
+    if(invalidRelaxation) resetRelaxation();
+    
+    assumps.copyTo(hardAssumptions);
+    conflictOnHardAssumptions = false;
+    lbool ret = optimize();
+    hardAssumptions.clear();
+    cancelUntil(0);
+    
+    // cores may depend on the assumptions
+    if(conflictOnHardAssumptions) invalidRelaxation = true;
+    return ret;
+}
+
+Lit MaxSatSolver::addSelector(const vec<Lit>& lits, int64_t weight) {
+    newVar();
+    while(weights.size() < nVars()) weights.push(0);
+    Lit soft = mkLit(nVars()-1);
+    
+    vec<Lit> clause;
+    lits.copyTo(clause);
+    clause.push(~soft);
+    addClause_(clause);
+    
+    softLiterals.push(soft);
+    weights[var(soft)] = weight;
+    setFrozen(var(soft), true);
+    return soft;
+}
+
+void MaxSatSolver::resetRelaxation() {
+    // Relaxations only constrain auxiliary variables and selectors, which can always be extended to a model.
+    // Soft clauses are then associated with fresh selectors, while the old ones are left unconstrained.
+    trace(maxsat, 10, "Reset relaxation of " << softLiterals.size() << " soft literals");
+    cancelUntil(0);
+    for(int i = 0; i < weights.size(); i++) weights[i] = 0;
+    softLiterals.clear();
+    lowerbound = 0;
+    for(int i = 0; i < selectors.size(); i++) {
+        if(selectors[i] == lit_Undef) continue;
+        selectors[i] = addSelector(softClauses[i], softClauseWeights[i]);
+    }
+    invalidRelaxation = false;
+}
+
 int64_t MaxSatSolver::nextUp(int64_t curr) const {
     int64_t res = INT64_MAX;
     for(int i = 0; i < softLiterals.size(); i++)
@@ -479,6 +624,8 @@ void MaxSatSolver::quickSort(int left, int right) {
 }
 
 void MaxSatSolver::solve_() {
+    if(disjcores == WCE) { solve_wce(); return; }
+    
     int vars = nVars();
     lastSoftLiteral = disjcores == NO ? INT_MAX : vars;
 
@@ -580,8 +727,7 @@ void MaxSatSolver::solve_() {
                     if(min == -1) return; //{cout<<"SSSSS" << endl; exit(-1);}
                     
                     cores[min]->moveTo(conflict);
-                    progressionMinimize(computeConflictWeight());
-                    trim();
+                    minimizeCore();
                     
                     if(conflict.size() > cacheSize) cacheSize = conflict.size();
                     
@@ -614,11 +760,10 @@ void MaxSatSolver::solve_() {
         if(conflict.size() == 0) return;
 
         assert(decisionLevel() == 0);
-        progressionMinimize(computeConflictWeight());
+        minimizeCore();
 //        biprogressionMinimize(limit);
 //        binaryMinimize(limit);
 //        progressionBinaryMinimize(limit);
-        trim(); // last trim, just in case some new learned clause may help to further reduce the core
 
         if(Glucose::cpuTime() < 600.0 && conflict.size() > cacheSize) {
             trace(maxsat, 5, "Cache conflict of size " << conflict.size() << " and weight " << computeConflictWeight());
@@ -639,6 +784,125 @@ void MaxSatSolver::solve_() {
     }
 }
 
+void MaxSatSolver::solve_wce() {
+    lastSoftLiteral = INT_MAX;
+    
+    int64_t limit = computeNextLimit(INT64_MAX);
+    int64_t nextLimit;
+    
+    vec<Lit> remaining;
+    vec<vec<Lit>*> delayed;
+    vec<int64_t> delayedWeights;
+    vec<bool> inCore;
+    
+    for(;;) {
+        if(softLiterals.size() > 1) quickSort(0, softLiterals.size()-1);
+        
+        hardening();
+        if(lowerbound == upperbound) return;
+        setAssumptions(limit);
+        assumptions.moveTo(remaining);
+        if(minimizer != NULL) minimizer->sync();
+        
+        // cores are disjoint: their literals are removed from the assumptions, and weights are left untouched until relaxation
+        // the lower bound is also increased at relaxation, as models found in the meantime still pay the unrelaxed weights
+        for(;;) {
+            remaining.copyTo(assumptions);
+            
+            lastConflict = conflicts;
+            lastPropagation = propagations;
+            lastCallCpuTime = Glucose::cpuTime();
+            
+            trace(maxsat, 2, "Solve with " << assumptions.size() << " assumptions and " << delayed.size() << " delayed cores. Current bounds: [" << lowerbound << ":" << upperbound << "]. Difference: " << (upperbound - lowerbound) << ".");
+            trace(maxsat, 100, "Assumptions: " << assumptions);
+            
+            sortAssumptions = true;
+            if(assumptions.size() == 0 && upperbound != INT64_MAX) status = l_Undef;
+            else PseudoBooleanSolver::solve();
+            sortAssumptions = false;
+            
+            if(status != l_False) break;
+            
+            cancelUntil(0);
+            trace(maxsat, 2, "UNSAT! Conflict of size " << conflict.size());
+            trace(maxsat, 100, "Conflict: " << conflict);
+            
+            if(conflict.size() == 0) {
+                if(minimizer != NULL) { vec<vec<Lit> > minimized; minimizer->wait(minimized); }
+                for(int i = 0; i < delayed.size(); i++) delete delayed[i];
+                return;
+            }
+            
+            if(minimizer == NULL) {
+                progressionMinimize(computeConflictWeight());
+                trim();
+            }
+            
+            inCore.growTo(nVars(), false);
+            for(int i = 0; i < conflict.size(); i++) inCore[var(conflict[i])] = true;
+            int j = 0;
+            for(int i = 0; i < remaining.size(); i++) {
+                if(inCore[var(remaining[i])]) continue;
+                remaining[j++] = remaining[i];
+            }
+            remaining.shrink_(remaining.size() - j);
+            for(int i = 0; i < conflict.size(); i++) inCore[var(conflict[i])] = false;
+            
+            // the core is minimized in background, and its weight is known only after that
+            if(minimizer != NULL) { minimizer->push(conflict, conflicts - lastConflict); continue; }
+            
+            int64_t w = computeConflictWeight();
+            trace(maxsat, 4, "Delay conflict of size " << conflict.size() << " and weight " << w);
+            delayed.push(new vec<Lit>());
+            conflict.moveTo(*delayed.last());
+            delayedWeights.push(w);
+        }
+        
+        if(status == l_True) updateUpperBound();
+        cancelUntil(0);
+        
+        if(minimizer != NULL) {
+            lbool status_ = status;
+            vec<vec<Lit> > minimized;
+            minimizer->wait(minimized);
+            for(int i = 0; i < minimized.size(); i++) {
+                minimized[i].moveTo(conflict);
+                trim();
+                int64_t w = computeConflictWeight();
+                trace(maxsat, 4, "Delay conflict of size " << conflict.size() << " and weight " << w);
+                delayed.push(new vec<Lit>());
+                conflict.moveTo(*delayed.last());
+                delayedWeights.push(w);
+            }
+            status = status_;
+        }
+        
+        if(delayed.size() > 0) {
+            trace(maxsat, 4, (status == l_True ? "SAT!" : "Skip!") << " Relax " << delayed.size() << " delayed cores on limit " << limit);
+            for(int i = 0; i < delayed.size(); i++) {
+                delayed[i]->moveTo(conflict);
+                delete delayed[i];
+                trace(maxsat, 4, "Analyze conflict of size " << conflict.size() << " and weight " << delayedWeights[i]);
+                updateLowerBound(delayedWeights[i]);
+                if(conflict.size() == 1) weights[var(conflict.last())] = 0;
+                else (this->*corestrat)(delayedWeights[i]);
+            }
+            delayed.clear();
+            delayedWeights.clear();
+            continue;
+        }
+        
+        nextLimit = computeNextLimit(limit);
+        if(nextLimit == limit) {
+            trace(maxsat, 4, (status == l_True ? "SAT!" : "Skip!") << " No other limit to try");
+            return;
+        }
+        
+        trace(maxsat, 4, (status == l_True ? "SAT!" : "Skip!") << " Decrease limit to " << nextLimit);
+        limit = nextLimit;
+    }
+}
+
 int64_t MaxSatSolver::computeConflictWeight() const {
     int64_t min = INT64_MAX;
     for(int i = 0; i < conflict.size(); i++) if(weights[var(conflict[i])] < min) min = weights[var(conflict[i])];
@@ -647,7 +911,8 @@ int64_t MaxSatSolver::computeConflictWeight() const {
 
 void MaxSatSolver::updateLowerBound(int64_t limit) {
     lowerbound += limit;
-    cout << "o " << lowerbound << endl;
+    if(portfolio != NULL) portfolio->updateLowerBound(lowerbound);
+    else if(!incremental && !quiet) cout << "o " << lowerbound << endl;
 }
 
 void MaxSatSolver::updateUpperBound() {
@@ -659,7 +924,8 @@ void MaxSatSolver::updateUpperBound() {
         upperbound = newupperbound;
         copyModel();
         trace(maxsat, 200, "Model: " << model);
-        cout << "c " << upperbound << " ub" << endl;
+        if(portfolio != NULL) portfolio->updateUpperBound(*this);
+        else if(!incremental && !quiet) cout << "c " << upperbound << " ub" << endl;
     }
 }
 
@@ -797,6 +1063,8 @@ void MaxSatSolver::trim() {
         assumptions.clear();
         for(int i = 0; i < conflict.size(); i++) assumptions.push(~conflict[i]);
         PseudoBooleanSolver::solve();
+        // threads of a portfolio are interrupted when the search is over, and stop here
+        if(status == l_Undef && portfolio != NULL) portfolio->sync(*this);
         assert(status == l_False);
         trace(maxsat, 15, "Trim " << assumptions.size() - conflict.size() << " literals from conflict");
         trace(maxsat, 100, "Conflict: " << conflict);
@@ -809,6 +1077,22 @@ void MaxSatSolver::trim() {
     assert(conflict.size() > 1);
 }
 
+void MaxSatSolver::minimizeCore() {
+    if(minimizer == NULL) {
+        progressionMinimize(computeConflictWeight());
+        trim(); // last trim, just in case some new learned clause may help to further reduce the core
+        return;
+    }
+    
+    uint64_t budget = conflicts - lastConflict;
+    trim();
+    if(budget == 0 || conflict.size() <= 1) return;
+    trace(maxsat, 10, "Minimize core of size " << conflict.size() << " with " << option_maxsat_minimize_threads << " helpers (each check with budget " << budget << ")");
+    minimizer->sync();
+    minimizer->minimize(conflict, budget);
+    trim();
+}
+
 void MaxSatSolver::progressionMinimize(int64_t limit) {
     assert(decisionLevel() == 0);
     if(conflict.size() <= 1) return;
@@ -22,9 +22,15 @@
 
 namespace aspino {
 
+class PortfolioSolver;
+class CoreMinimizer;
+
 class MaxSatSolver : public PseudoBooleanSolver {
+    friend class MaxSatPreprocessor;
+    friend class PortfolioSolver;
+    friend class CoreMinimizer;
 public:
-    MaxSatSolver();
+    MaxSatSolver(bool incremental = false);
     virtual ~MaxSatSolver();
     
     virtual void interrupt();
@@ -36,8 +42,32 @@ public:
     virtual lbool solve();
     virtual lbool solve(int) { return solve(); }
     
+    // Incremental interface, for solvers constructed as incremental.
+    // Clauses are on variables created by newVar(), and soft clauses are identified by the index returned by addSoftClause().
+    // Relaxations and learned clauses are preserved between calls to solve(assumptions).
+    bool addHardClause(vec<Lit>& lits);
+    int addSoftClause(vec<Lit>& lits, int64_t weight);
+    void removeSoftClause(int index);
+    lbool solve(const vec<Lit>& assumptions);
+    inline int64_t getLowerBound() const { return lowerbound; }
+    inline int64_t getUpperBound() const { return upperbound; }
+    
     void onTick();
     
+protected:
+    // soft clause of an objective level: levels are optimized by decreasing priority
+    void addWeightedClause(vec<Lit>& lits, int64_t weight, int64_t priority);
+    
+    // optimum of each level, from the highest priority; nothing is printed
+    lbool optimize(vec<int64_t>& optima);
+    // cost of the best model found so far on each level, from the highest priority; false if there is no model yet
+    bool bestCosts(vec<int64_t>& costs) const;
+    
+    // solvers whose propagators rely on the input clauses turn off the simplifications of MaxSatPreprocessor
+    bool preprocessing;
+    
+    // solvers with their own output format turn off the bounds printed while optimizing
+    bool quiet;
     
 private:
     int64_t upperbound;
@@ -54,13 +84,37 @@ private:
     double lastCallCpuTime;
     double timeBudget;
     
+    bool incremental;
+    vec<vec<Lit> > softClauses;
+    vec<int64_t> softClauseWeights;
+    vec<Lit> selectors;
+    bool invalidRelaxation;
+    
+    lbool optimize();
+    Lit addSelector(const vec<Lit>& lits, int64_t weight);
+    void resetRelaxation();
+    
+    // lexicographic optimization: soft clauses of each level are added when all levels of higher priority are optimized
+    struct Objective {
+        int64_t priority;
+        vec<vec<Lit> > clauses;
+        vec<int64_t> weights;
+    };
+    vec<Objective*> objectives;
+    vec<int64_t> optimizedLevels;
+    bool lexicographic;
+    
+    // soft literals of the level being optimized, before relaxation: bounds of the relaxed formula may overestimate the cost of a model
+    vec<Lit> levelSoftLiterals;
+    vec<int64_t> levelWeights;
+    int64_t levelOffset;
+    Objective& objective(int64_t priority);
+    
     void quickSort(int left, int right);
     
     void sameSoftVar(Lit soft, int64_t weight);
     
     void removeSoftLiteralsAtLevelZero();
-    bool tautology(Var var, CRef c1, CRef c2);
-    void bce();
     void preprocess();
 //    void initUpperBound();
     void hardening();
@@ -68,6 +122,7 @@ private:
     int64_t computeNextLimit(int64_t limit) const;
     void solveCurrentLevel();
     void solve_();
+    void solve_wce();
     
     int64_t nextUp(int64_t curr) const;
     int64_t computeConflictWeight() const;
@@ -83,6 +138,7 @@ private:
     void binaryMinimize(int64_t limit);
     void progressionBinaryMinimize(int64_t limit);
     void minimize();
+    void minimizeCore();
     
     void (MaxSatSolver::*corestrat)(int64_t);
     void corestrat_one(int64_t limit);
@@ -101,10 +157,19 @@ private:
     void corestrat_wone_gcd(int64_t limit);
     void corestrat_wone_remainder(int64_t limit);
 
-    enum DisjunctCores {NO = 0, PRE, ALL};
+    enum DisjunctCores {NO = 0, PRE, ALL, WCE};
     DisjunctCores disjcores;
     
     vec<vec<Lit>*> cores;
+    
+    void setCoreStrategy(const char* name);
+    void setDisjunctCores(const char* name);
+    
+    // set when running in a portfolio: bounds and models are shared, and results are printed by the portfolio
+    PortfolioSolver* portfolio;
+    
+    // helpers minimizing cores in parallel, if enabled
+    CoreMinimizer* minimizer;
 };
 
 
@@ -23,11 +23,20 @@
 
 #include "utils/algorithm.h"
 
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
 using Glucose::Map;
 
 extern Glucose::BoolOption option_print_model;
 
-Glucose::IntOption option_threads("MAIN", "t", "Number of threads (used by PMaxSat).", 4, Glucose::IntRange(0, INT32_MAX));
+Glucose::IntOption option_threads("MAIN", "t", "Number of threads (used by PMaxSat and portfolio).", 4, Glucose::IntRange(0, INT32_MAX));
+Glucose::IntOption option_share_lbd("MAIN", "share-lbd", "Share learned clauses with LBD up to this value among threads, 0 to disable (used by PMaxSat).", 2, Glucose::IntRange(0, INT32_MAX));
+Glucose::BoolOption option_pin_threads("MAIN", "pin-threads", "Pin each thread to a CPU (used by PMaxSat).", false);
+Glucose::BoolOption option_shared_clauses("MAIN", "shared-clauses", "Store input hard clauses once, in an arena read by all threads (used by PMaxSat).", false);
+Glucose::BoolOption option_deterministic("MAIN", "deterministic", "Synchronize threads at conflict barriers, so that runs are reproducible (used by PMaxSat).", false);
+Glucose::IntOption option_barrier_conflicts("MAIN", "barrier-conflicts", "Conflicts of each thread between two barriers of the deterministic mode (used by PMaxSat).", 10000, Glucose::IntRange(1, INT32_MAX));
 
 namespace aspino {
 
@@ -36,6 +45,7 @@ int PMaxSatSolver::Task::currLevel = 0;
 static const int buffer_size = 1048576;
 
 static std::mutex trace_lock;
+static std::mutex interrupt_lock;
 
 #define trace_(id, level, msg) { \
     std::unique_lock<std::mutex> locker(trace_lock); \
@@ -78,13 +88,16 @@ int64_t parseLong(LineStream& in) {
     
 void solveTask(void* solver_, void* task_) {
     PMaxSatSolver* solver = static_cast<PMaxSatSolver*>(solver_);
+    PMaxSatSolver::Task& task = *static_cast<PMaxSatSolver::Task*>(task_);
     solver->cancelUntil(0);
     
-    PMaxSatSolver::Msg msg(*static_cast<PMaxSatSolver::Task*>(task_));
+    PMaxSatSolver::Msg msg(task);
     msg.assumptions.copyTo(solver->assumptions);
     
-    msg.status = solver->solveTask();
-    if(msg.status == l_True) {
+    try { msg.status = solver->solveTask(task); }
+    catch(Glucose::OutOfMemoryException&) { solver->interrupt(); }
+    if(msg.status == l_Undef) msg.paused = option_deterministic && task.conflicts < solver->solvers[0]->budget;
+    else if(msg.status == l_True) {
         solver->updateUpperBound();
         msg.upperbound = solver->upperbound;
     }
@@ -94,11 +107,11 @@ void solveTask(void* solver_, void* task_) {
         solver->conflict.moveTo(msg.core);
     }
     
-    static_cast<PMaxSatSolver::Task*>(task_)->done_ = true;
+    task.done_ = true;
     solver->add(msg);
 }
     
-PMaxSatSolver::PMaxSatSolver(PMaxSatSolver* master, int id_) : id(id_), taskLevel(-1), taskId(-1), myupperbound(INT64_MAX), upperbound(INT64_MAX), lowerbound(0), tSolve(NULL), lastConflict(0), lastPropagation(0), lastCallCpuTime(0.0) /*, timeBudget(0.0)*/ {
+PMaxSatSolver::PMaxSatSolver(PMaxSatSolver* master, int id_) : id(id_), taskLevel(-1), taskId(-1), myupperbound(INT64_MAX), upperbound(INT64_MAX), lowerbound(0), msgs(2 * option_threads), pendingMsgs(0), roundPos(0), worker(NULL), slot(NULL), quit(false), interrupted(false), copier(std::thread::id()), sharedVars(0), arena(NULL), moreConflictArena(-1), nextToPropagateArena(0), lastConflict(0), lastPropagation(0), lastCallCpuTime(0.0) /*, timeBudget(0.0)*/ {
     setIncrementalMode();
     if(master != NULL) solvers.push(master);
     else {
@@ -108,10 +121,310 @@ PMaxSatSolver::PMaxSatSolver(PMaxSatSolver* master, int id_) : id(id_), taskLeve
 }
 
 PMaxSatSolver::~PMaxSatSolver() {
+    stopWorker();
     for(int i = 1; i < solvers.size(); i++) delete solvers[i];
+    if(solvers[0] == this) delete arena;
+}
+
+void PMaxSatSolver::startWorker() {
+    if(worker != NULL) return;
+    quit = false;
+    worker = new thread(&PMaxSatSolver::work, this);
+}
+
+void PMaxSatSolver::stopWorker() {
+    if(worker == NULL) return;
+    asynch_interrupt = true;
+    std::unique_lock<std::mutex> locker(slotLock);
+    quit = true;
+    locker.unlock();
+    slotChanged.notify_all();
+    worker->join();
+    delete worker;
+    worker = NULL;
+}
+
+void PMaxSatSolver::work() {
+#ifdef __linux__
+    if(option_pin_threads && thread::hardware_concurrency() > 0) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(id % thread::hardware_concurrency(), &cpus);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    }
+#endif
+    for(;;) {
+        std::unique_lock<std::mutex> locker(slotLock);
+        slotChanged.wait(locker, [this](){ return slot != NULL || quit; });
+        if(quit) return;
+        Task* task = slot;
+        locker.unlock();
+        
+        aspino::solveTask(this, task);
+        
+        locker.lock();
+        slot = NULL;
+        locker.unlock();
+        slotChanged.notify_all();
+    }
+}
+
+void PMaxSatSolver::post(Task* task) {
+    std::unique_lock<std::mutex> locker(slotLock);
+    assert(slot == NULL);
+    slot = task;
+    locker.unlock();
+    slotChanged.notify_all();
+}
+
+void PMaxSatSolver::waitIdle() {
+    std::unique_lock<std::mutex> locker(slotLock);
+    slotChanged.wait(locker, [this](){ return slot == NULL; });
+}
+
+void PMaxSatSolver::parallelExportUnaryClause(Lit p) {
+    if(option_share_lbd == 0 || solvers[0]->solvers.size() == 1 || var(p) >= sharedVars) return;
+    exported.push(&p, 1);
+}
+
+void PMaxSatSolver::parallelExportClauseDuringSearch(Clause& c) {
+    if(option_share_lbd == 0 || solvers[0]->solvers.size() == 1) return;
+    if(c.lbd() > static_cast<unsigned>(option_share_lbd) || c.size() > ClauseRing::maxClauseSize) return;
+    ringBuffer.clear();
+    for(int i = 0; i < c.size(); i++) {
+        if(var(c[i]) >= sharedVars) return;
+        ringBuffer.push(c[i]);
+    }
+    exported.push(ringBuffer, ringBuffer.size());
+}
+
+bool PMaxSatSolver::parallelImportClauses() {
+    // in deterministic mode, clauses are imported by the master at barriers
+    if(option_deterministic) return false;
+    return importClauses();
+}
+
+bool PMaxSatSolver::importClauses() {
+    assert(decisionLevel() == 0);
+    if(option_share_lbd == 0) return false;
+    PMaxSatSolver* master = solvers[0];
+    imported.growTo(master->solvers.size(), 0);
+    for(int i = 0; i < master->solvers.size(); i++) {
+        if(i == id) continue;
+        ClauseRing& ring = master->solvers[i]->exported;
+        while(ring.pop(imported[i], ringBuffer)) if(!importClause(ringBuffer)) return true;
+    }
+    return false;
+}
+
+bool PMaxSatSolver::importClause(vec<Lit>& lits) {
+    int j = 0;
+    for(int i = 0; i < lits.size(); i++) {
+        if(var(lits[i]) >= sharedVars || value(lits[i]) == l_True) return true;
+        if(value(lits[i]) == l_False) continue;
+        lits[j++] = lits[i];
+    }
+    lits.shrink_(lits.size() - j);
+    
+    if(lits.size() == 0) return false;
+    if(lits.size() == 1) { uncheckedEnqueue(lits[0]); return true; }
+    CRef cr = ca.alloc(lits, true);
+    ca[cr].setLBD(lits.size());
+    learnts.push(cr);
+    attachClause(cr);
+    return true;
+}
+
+void PMaxSatSolver::newVar() {
+    PseudoBooleanSolver::newVar();
+    arenaWatches.push();
+    arenaWatches.push();
+    moreReasonArena.push(-1);
+}
+
+void PMaxSatSolver::moveClausesToArena() {
+    assert(decisionLevel() == 0);
+    ClauseArena* a = new ClauseArena();
+    a->offsets.push(0);
+    for(int i = 0; i < clauses.size(); i++) {
+        Clause& c = ca[clauses[i]];
+        int j = a->lits.size();
+        for(int k = 0; k < c.size(); k++) {
+            if(value(c[k]) == l_True) { a->lits.shrink_(a->lits.size() - j); j = -1; break; }
+            if(value(c[k]) == l_False) continue;
+            a->lits.push(c[k]);
+        }
+        if(j != -1) {
+            assert(a->lits.size() - j >= 2);
+            a->offsets.push(a->lits.size());
+        }
+        removeClause(clauses[i]);
+    }
+    clauses.clear();
+    trace_(id, 5, "Moved " << a->size() << " clauses (" << a->lits.size() << " literals) to the shared arena");
+    attachArena(a);
+}
+
+void PMaxSatSolver::attachArena(const ClauseArena* a) {
+    arena = a;
+    arenaWatched.growTo(2 * a->size());
+    for(int i = 0; i < a->size(); i++) {
+        int first = a->offsets[i];
+        arenaWatched[2*i] = first;
+        arenaWatched[2*i+1] = first + 1;
+        arenaWatches[toInt(~a->lits[first])].push(ArenaWatch(i, a->lits[first + 1]));
+        arenaWatches[toInt(~a->lits[first + 1])].push(ArenaWatch(i, a->lits[first]));
+    }
+}
+
+CRef PMaxSatSolver::morePropagate() {
+    if(arena != NULL) {
+        while(nextToPropagateArena < nextToPropagateByUnit()) {
+            CRef ret = propagateArena(mainTrail(nextToPropagateArena++));
+            if(ret != CRef_Undef) return ret;
+        }
+    }
+    return PseudoBooleanSolver::morePropagate();
+}
+
+CRef PMaxSatSolver::propagateArena(Lit lit) {
+    vec<ArenaWatch>& ws = arenaWatches[toInt(lit)];
+    const vec<Lit>& lits = arena->lits;
+    int i, j;
+    for(i = j = 0; i < ws.size(); i++) {
+        ArenaWatch w = ws[i];
+        if(value(w.blocker) == l_True) { ws[j++] = w; continue; }
+        
+        int me = 2 * w.clause;
+        if(lits[arenaWatched[me]] != ~lit) me++;
+        assert(lits[arenaWatched[me]] == ~lit);
+        Lit other = lits[arenaWatched[me ^ 1]];
+        if(value(other) == l_True) { ws[j++] = ArenaWatch(w.clause, other); continue; }
+        
+        int k = arena->offsets[w.clause];
+        int end = arena->offsets[w.clause + 1];
+        for(; k < end; k++) {
+            if(k == arenaWatched[me] || k == arenaWatched[me ^ 1]) continue;
+            if(value(lits[k]) != l_False) break;
+        }
+        if(k < end) {
+            arenaWatched[me] = k;
+            arenaWatches[toInt(~lits[k])].push(ArenaWatch(w.clause, other));
+            continue;
+        }
+        
+        ws[j++] = w;
+        if(value(other) == l_False) {
+            trace_(id, 20, "Conflict on arena clause " << w.clause);
+            moreConflictArena = w.clause;
+            while(++i < ws.size()) ws[j++] = ws[i];
+            ws.shrink_(ws.size() - j);
+            return CRef_MoreConflict;
+        }
+        assert(moreReasonArena[var(other)] == -1);
+        moreReasonArena[var(other)] = w.clause;
+        moreReasonArenaVars.push(var(other));
+        uncheckedEnqueue(other);
+    }
+    ws.shrink_(i - j);
+    return CRef_Undef;
+}
+
+void PMaxSatSolver::analyzeArenaLit(Lit q, vec<Lit>& out_learnt, vec<Lit>& selectors, int& pathC) {
+    assert(value(q) == l_False);
+    
+    if(seen[var(q)]) return;
+    if(level(var(q)) == 0) return;
+    
+    if(!isSelector(var(q)))
+        varBumpActivity(var(q));
+    
+    seen[var(q)] = 1;
+    
+    if(level(var(q)) >= decisionLevel()) {
+        pathC++;
+        // UPDATEVARACTIVITY trick (see competition'09 companion paper)
+        if(!isSelector(var(q)) && (reason(var(q)) != CRef_Undef) && ca[reason(var(q))].learnt())
+            lastDecisionLevel.push(q);
+    }
+    else {
+        if(isSelector(var(q))) selectors.push(q);
+        else out_learnt.push(q);
+    }
+}
+
+bool PMaxSatSolver::moreReason(Lit lit, vec<Lit>& out_learnt, vec<Lit>& selectors, int& pathC) {
+    if(moreReasonArena[var(lit)] == -1) return PseudoBooleanSolver::moreReason(lit, out_learnt, selectors, pathC);
+    assert(decisionLevel() != 0);
+    assert(reason(var(lit)) == CRef_Undef);
+    int c = moreReasonArena[var(lit)];
+    for(int k = arena->offsets[c]; k < arena->offsets[c + 1]; k++) {
+        Lit q = arena->lits[k];
+        if(q == lit) continue;
+        assert(level(var(q)) <= level(var(lit)));
+        analyzeArenaLit(q, out_learnt, selectors, pathC);
+    }
+    return true;
+}
+
+bool PMaxSatSolver::moreReason(Lit lit) {
+    if(moreReasonArena[var(lit)] == -1) return PseudoBooleanSolver::moreReason(lit);
+    assert(decisionLevel() != 0);
+    assert(reason(var(lit)) == CRef_Undef);
+    int c = moreReasonArena[var(lit)];
+    for(int k = arena->offsets[c]; k < arena->offsets[c + 1]; k++) {
+        Lit l = arena->lits[k];
+        if(l == lit) continue;
+        assert(value(l) == l_False);
+        if(level(var(l)) == 0) continue;
+        seen[var(l)] = 1;
+    }
+    return true;
+}
+
+bool PMaxSatSolver::moreConflict(vec<Lit>& out_learnt, vec<Lit>& selectors, int& pathC) {
+    if(moreConflictArena == -1) return PseudoBooleanSolver::moreConflict(out_learnt, selectors, pathC);
+    assert(decisionLevel() != 0);
+    int c = moreConflictArena;
+    moreConflictArena = -1;
+    for(int k = arena->offsets[c]; k < arena->offsets[c + 1]; k++) analyzeArenaLit(arena->lits[k], out_learnt, selectors, pathC);
+    return true;
+}
+
+void PMaxSatSolver::onCancel() {
+    PseudoBooleanSolver::onCancel();
+    if(nextToPropagateArena > nextToPropagateByUnit()) nextToPropagateArena = nextToPropagateByUnit();
+    while(moreReasonArenaVars.size() > 0) {
+        Var v = moreReasonArenaVars.last();
+        if(level(v) <= decisionLevel()) break;
+        moreReasonArenaVars.pop();
+        moreReasonArena[v] = -1;
+    }
 }
 
 void PMaxSatSolver::interrupt() { 
+    // workers may call this function concurrently, but only the first one prints the best model
+    std::unique_lock<std::mutex> locker(interrupt_lock);
+    PMaxSatSolver* master = solvers[0];
+    master->interrupted = true;
+    for(int i = 0; i < master->solvers.size(); i++) master->solvers[i]->asynch_interrupt = true;
+    
+    // a model being copied by another thread is waited for; locks are not taken, as a signal may interrupt their owner
+    for(int i = 0; i < master->solvers.size(); i++) {
+        PMaxSatSolver* solver = master->solvers[i];
+        while(solver->copier.load() != std::thread::id() && solver->copier.load() != std::this_thread::get_id()) std::this_thread::yield();
+    }
+    
+    int best = -1;
+    for(int i = 0; i < master->solvers.size(); i++) {
+        if(master->solvers[i]->myupperbound == INT64_MAX) continue;
+        if(best == -1 || master->solvers[i]->myupperbound < master->solvers[best]->myupperbound) best = i;
+    }
+    if(best == -1) cout << "s UNKNOWN" << endl;
+    else {
+        cout << "s SATISFIABLE" << endl;
+        if(option_print_model) master->solvers[best]->printModel();
+    }
     this->exit(1);
 }
 
@@ -307,8 +620,10 @@ void PMaxSatSolver::lastCheck() {
 //            softLiterals.moveTo(assumptions);
 //            for(int i = 0; i < weights.size(); i++) if(weights[i] < 0) cout << i << " "<< weights[i] << endl;
             PseudoBooleanSolver::solve();
-            trace_(id, 5, (status == l_True ? "SAT!" : "UNSAT!"));
+            trace_(id, 5, (status == l_True ? "SAT!" : status == l_False ? "UNSAT!" : "UNKNOWN!"));
         }
+        // an interrupted call proves nothing, and only the best model found so far can be printed
+        if(status == l_Undef) { interrupt(); return; }
         if(status == l_True) updateUpperBound();
         else lowerbound = upperbound;
     }
@@ -369,10 +684,14 @@ void PMaxSatSolver::updateUpperBound() {
         if(value(softLiterals[i]) == l_False) newupperbound += weights[var(softLiterals[i])];
     }
     if(newupperbound < upperbound) {
-        upperbound = newupperbound;
-        myupperbound = newupperbound;
-        copyModel();
-        trace_(id, 200, "Model: " << model);
+        copier = std::this_thread::get_id();
+        if(!solvers[0]->interrupted) {
+            upperbound = newupperbound;
+            myupperbound = newupperbound;
+            copyModel();
+            trace_(id, 200, "Model: " << model);
+        }
+        copier = std::thread::id();
     }
 }
 
@@ -434,17 +753,15 @@ bool PMaxSatSolver::handleModel() const {
 
 void PMaxSatSolver::stop(Task& task) {
     assert(id == 0);
-    if(task.tSolve == NULL) return;
+    if(!task.running) return;
     assert(task.solverId != -1);
     trace_(id, 20, "Stop solver " << task.solverId);
 
     PMaxSatSolver* solver = solvers[task.solverId];
     solver->asynch_interrupt = true;
     
-    assert(task.tSolve->joinable());
-    task.tSolve->join();
-    delete task.tSolve;
-    task.tSolve = NULL;
+    solver->waitIdle();
+    task.running = false;
     assert(task.done());
 
     solver->asynch_interrupt = false;
@@ -462,29 +779,84 @@ void PMaxSatSolver::assignTasks() {
         PMaxSatSolver* solver = solvers[freeSolvers.last()];
         freeSolvers.pop();
         tasks[j].solverId = solver->id;
-        tasks[j].tSolve = new thread(aspino::solveTask, static_cast<void*>(solver), static_cast<void*>(&tasks[j]));
+        tasks[j].running = true;
+        pendingMsgs++;
+        solver->post(&tasks[j]);
         
         trace_(id, 20, "Assign task " << tasks[j] << " to solver " << solver->id);
     }
 }
 
-void PMaxSatSolver::add(const Msg& msg) {
+void PMaxSatSolver::add(Msg& msg) {
     if(this != solvers[0]) { solvers[0]->add(msg); return; }
     
     trace_(id, 1, "ADD " << msg);
+    msgs.push(msg);
+}
+
+bool PMaxSatSolver::nextMsg(Msg& msg) {
+    if(!option_deterministic) {
+        for(;;) {
+            if(msgs.pop(msg)) return true;
+            bool stop_ = pendingMsgs == 0;
+            for(int i = 0; i < tasks.size() && stop_; i++) if(!tasks[i].done()) stop_ = false;
+            if(stop_) return false;
+            msgs.wait();
+        }
+    }
     
-    std::unique_lock<std::mutex> locker(lock);
-    msgs.push_back(msg);
-    locker.unlock();
-    noMsgs.notify_one();
+    if(roundPos == round.size()) {
+        if(round.size() > 0) barrier();
+        round.clear();
+        roundPos = 0;
+        if(pendingMsgs == 0) return false;
+        
+        // wait for all tasks of the round, and sort their messages by task
+        while(round.size() < pendingMsgs) {
+            round.push();
+            while(!msgs.pop(round.last())) msgs.wait();
+        }
+        for(int i = 1; i < round.size(); i++)
+            for(int j = i; j > 0 && round[j].assumptions.size() < round[j-1].assumptions.size(); j--) round[j].swap(round[j-1]);
+        trace_(id, 10, "Round of " << round.size() << " messages");
+    }
+    msg.swap(round[roundPos++]);
+    return true;
+}
+
+void PMaxSatSolver::barrier() {
+    assert(id == 0);
+    for(int i = 0; i < solvers.size(); i++) solvers[i]->waitIdle();
+    
+    // all solvers are idle, so each one reads the same clauses in every run
+    for(int i = 0; i < solvers.size(); i++) {
+        solvers[i]->cancelUntil(0);
+        solvers[i]->importClauses();
+    }
+    
+    for(int i = 0; i < tasks.size(); i++) {
+        if(!tasks[i].paused) continue;
+        tasks[i].paused = false;
+        if(!tasks[i].running) continue;
+        trace_(id, 20, "Resume task " << tasks[i] << " on solver " << tasks[i].solverId);
+        tasks[i].done_ = false;
+        pendingMsgs++;
+        solvers[tasks[i].solverId]->post(&tasks[i]);
+    }
+    assignTasks();
 }
 
-lbool PMaxSatSolver::solveTask() { 
+lbool PMaxSatSolver::solveTask(Task& task) { 
     time_t t = time(0); 
-    setConfBudget(solvers[0]->budget);
-    cout << "START ASS: " << assumptions.size() << endl;
+    int64_t budget_ = solvers[0]->budget;
+    if(option_deterministic) budget_ = min(budget_ - task.conflicts, static_cast<int64_t>(option_barrier_conflicts));
+    uint64_t conflicts_ = conflicts;
+    setConfBudget(budget_);
+    // workers print nothing, as the order of their lines would depend on timing
+    trace_(id, 20, "Start task with " << assumptions.size() << " assumptions");
     lbool res = PseudoBooleanSolver::solve();
-    cout << "TIME: " << difftime(time(0), t) << "; ASS: " << assumptions.size() << endl;
+    trace_(id, 20, "Task done in " << difftime(time(0), t) << " s with " << assumptions.size() << " assumptions");
+    task.conflicts += conflicts - conflicts_;
     budgetOff();
     clearInterrupt();
     return res; 
@@ -502,6 +874,7 @@ lbool PMaxSatSolver::solve() {
     removeSoftLiteralsAtLevelZero();
     
     assert(cconstraints.size() == 0);
+    if(option_shared_clauses && solvers.size() > 1) moveClausesToArena();
     for(int i = 1; i < solvers.size(); i++) {
         solvers[i]->nInVars(nInVars());
         solvers[i]->lowerbound = lowerbound;
@@ -514,6 +887,7 @@ lbool PMaxSatSolver::solve() {
         }
         
         vec<Lit> lits;
+        if(arena != NULL) solvers[i]->attachArena(arena);
         for(int j = 0; j < clauses.size(); j++) {
             Clause& clause = ca[clauses[j]];
             for(int k = 0; k < clause.size(); k++) lits.push(clause[k]);
@@ -537,10 +911,16 @@ lbool PMaxSatSolver::solve() {
     int64_t limit = computeNextLimit(INT64_MAX);
     int64_t nextLimit;
     
-    budget = conflicts;
+    // bound of all solvers at the last round; the bound of solver 0 is also written by its worker
+    int64_t sharedUpperbound = upperbound;
+    
+    // a budget of 0 would stay 0 when doubled
+    budget = max(static_cast<int64_t>(conflicts), static_cast<int64_t>(1));
     
     freeSolvers.clear();
     for(int i = 0; i < solvers.size(); i++) freeSolvers.push(i);
+    for(int i = 0; i < solvers.size(); i++) solvers[i]->sharedVars = nVars();
+    for(int i = 0; i < solvers.size(); i++) solvers[i]->startWorker();
 
     for(;;) {
         assert(tasks.size() == 0);
@@ -559,7 +939,13 @@ lbool PMaxSatSolver::solve() {
         trace_(id, 100, "Assumptions: " << assumptions);
         
         assert(decisionLevel() == 0);
-        if(assumptions.size() == 0 && upperbound != INT64_MAX) status = l_Undef;
+        if(assumptions.size() == 0 && upperbound != INT64_MAX) {
+            // all soft literals of this limit are hardened, so the next limit is tried, and a pending core is dropped
+            status = l_Undef;
+            soft.clear();
+            softSatUpTo = 0;
+            core.clear();
+        }
         else {
             vec<Lit> lits;
             if(core.size() == 0) {
@@ -595,49 +981,20 @@ lbool PMaxSatSolver::solve() {
             assignTasks();
         }
         
-        bool debug = false;
-        int NEXT = tasks[0].assumptions.size();
-        
-        // handle msgs
-        int64_t ub = upperbound;
-        for(;;) {
-            std::unique_lock<std::mutex> locker(lock);
-            
-            if(msgs.size() == 0 || debug) {
-                bool stop_ = msgs.size() == 0;
-                for(int i = 0; i < tasks.size(); i++) if(!tasks[i].done()) { stop_ = false; break; }
-                if(stop_) {
-                    locker.unlock();
-                    break;
-                }
-                if(debug) noMsgs.wait(locker, [this, NEXT](){ assignTasks(); for(list<Msg>::const_iterator it = msgs.begin(); it != msgs.end(); it++) if(it->assumptions.size() == NEXT) return true; return false; });
-                else noMsgs.wait(locker, [this](){ return msgs.size() > 0; });
-            }
-            
-            trace_(id, 5, "Pop from " << msgs.size() << " msgs");
-            for(list<Msg>::const_iterator it = msgs.begin(); it != msgs.end(); it++) trace_(id, 5, " >>> " << *it);
-            Msg* msg_ = NULL;
-            if(debug) {
-                list<Msg>::iterator it;
-                for(it = msgs.begin(); it != msgs.end(); it++) if(it->assumptions.size() == NEXT) {
-                    break;
-                }
-                assert(it != msgs.end());
-                msg_ = new Msg(*it);
-                msgs.erase(it);
-                NEXT++;
-            }
-            else {
-                msg_ = new Msg(msgs.front());
-                msgs.pop_front();
-            }
-            Msg& msg = *msg_;
-            for(list<Msg>::const_iterator it = msgs.begin(); it != msgs.end(); it++) trace_(id, 5, "after pop " << *it);
-            locker.unlock();
+        // handle msgs: each assigned task sends exactly one msg, even if stopped
+        int64_t ub = sharedUpperbound;
+        bool optimal = false;
+        Msg msg;
+        while(nextMsg(msg)) {
+            pendingMsgs--;
             
             trace_(id, 10, msg);
             
             assert(msg.level == Task::currLevel);
+            if(msg.paused) {
+                for(int i = 0; i < tasks.size(); i++) if(tasks[i].assumptions.size() == msg.assumptions.size()) { tasks[i].paused = true; break; }
+                continue;
+            }
 //            if(msg.level < Task::currLevel) { trace_(id, 20, "ignored level"); continue;} 
             
             if(msg.status == l_True) {
@@ -659,8 +1016,11 @@ lbool PMaxSatSolver::solve() {
                     if(tasks[i].assumptions.size() <= msg.assumptions.size()) { stop(tasks[i]); assert(!solvers[tasks[i].solverId]->asynch_interrupt); }
                 }
                 
-                assignTasks();
-                if(freeSolvers.size() > 0 && tasks.size() > solvers.size()) for(int i = 0; i < tasks.size(); i++) stop(tasks[i]);
+                // in deterministic mode, tasks are assigned at the barrier
+                if(!option_deterministic) {
+                    assignTasks();
+                    if(freeSolvers.size() > 0 && tasks.size() > solvers.size()) for(int i = 0; i < tasks.size(); i++) stop(tasks[i]);
+                }
             }
             else if(msg.status == l_False) {
                 if(core.size() != 0 && msg.core.size() >= core.size()) { trace_(id, 10, "ignored unsat"); continue;}
@@ -669,8 +1029,10 @@ lbool PMaxSatSolver::solve() {
                 tasks.clear();
                 assert(freeSolvers.size() == solvers.size());
                 
+                // the soft literals hardened by the upper bound are inconsistent, so no model is better than the upper bound
+                if(msg.core.size() == 0) { core.clear(); optimal = true; continue; }
+                
                 if(core.size() == 0) {
-                    assert(msg.core.size() > 0); //if(msg.core.size() == 0) return l_True; // TERMINA (potrebbe non terminare se i thread non sono demoni)
                     msg.core.moveTo(core);
                     
                     int j = core.size() - 1;
@@ -691,19 +1053,27 @@ lbool PMaxSatSolver::solve() {
                 for(int i = 0; i < tasks.size(); i++) {
                     if(tasks[i].assumptions.size() == msg.assumptions.size()) { stop(tasks[i]); assert(!solvers[tasks[i].solverId]->asynch_interrupt); break; }
                 }
-                assignTasks();
-                if(freeSolvers.size() > 0 && tasks.size() > solvers.size()) for(int i = 0; i < tasks.size(); i++) stop(tasks[i]);
+                if(!option_deterministic) {
+                    assignTasks();
+                    if(freeSolvers.size() > 0 && tasks.size() > solvers.size()) for(int i = 0; i < tasks.size(); i++) stop(tasks[i]);
+                }
             }
         } // msgs
-        assert(msgs.size() == 0);
+        assert(msgs.empty());
         
         for(int i = 0; i < tasks.size(); i++) assert(tasks[i].done());
         tasks.clear();
         assert(freeSolvers.size() == solvers.size());
         
-        if(ub < upperbound) {
-            for(int i = 0; i < solvers.size(); i++) solvers[i]->upperbound = ub;
-            cout << "c " << upperbound << " ub" << endl;
+        // the task of a solver improves its own bound, the master included, so each solver is updated
+        // otherwise solvers would harden different soft literals, and answer for different formulas
+        if(ub < sharedUpperbound) { sharedUpperbound = ub; cout << "c " << ub << " ub" << endl; }
+        for(int i = 0; i < solvers.size(); i++) if(ub < solvers[i]->upperbound) solvers[i]->upperbound = ub;
+        
+        if(optimal) {
+            lowerbound = upperbound;
+            lastCheck();
+            return l_True;
         }
         
         if(core.size() > 0) {
@@ -718,6 +1088,7 @@ lbool PMaxSatSolver::solve() {
                 solvers[i]->cancelUntil(0);
                 solvers[i]->lowerbound += limit;
                 solvers[i]->processCore(limit);
+                solvers[i]->sharedVars = solvers[i]->nVars();
             }
             core.clear();
             
@@ -19,11 +19,14 @@
 #define __PMaxSatSolver_h__
 
 #include "PseudoBooleanSolver.h"
+#include "utils/ClauseRing.h"
+#include "utils/MsgQueue.h"
 
 #include <thread>
 #include <mutex>
 #include <condition_variable>
-#include <list>
+#include <atomic>
+#include <utility>
 #include <utils/System.h>
 
 namespace aspino {
@@ -38,6 +41,7 @@ public:
     virtual void parse(gzFile in);
     virtual bool okay() const { return true; }
     
+    virtual void newVar();
     void addWeightedClause(vec<Lit>& lits, int64_t weight);
     
     virtual lbool solve();
@@ -45,9 +49,6 @@ public:
     
 //    void onTick();
     
-    std::mutex lock;
-    std::condition_variable noMsgs;
-    
 private:
     vec<PMaxSatSolver*> solvers;
     vec<int> freeSolvers;
@@ -64,13 +65,16 @@ private:
     
     struct Task {
         friend ostream& operator<<(ostream& out, const Task& task) { return out << "[level=" << task.level << "; assumptions=" << task.assumptions << "]"; }
-        inline Task() : level(currLevel), tSolve(NULL), solverId(-1), done_(false) {}
+        inline Task() : level(currLevel), running(false), solverId(-1), done_(false), paused(false), conflicts(0) {}
 //        inline Task(int level_, int id_, vec<Lit>& ass) :level(level_), id(id_) { ass.moveTo(assumptions); }
         int level;
         vec<Lit> assumptions;
-        thread* tSolve;
+        bool running;
         int solverId;
         bool done_;
+        // deterministic mode: the task reached a barrier before its budget, and it is resumed by the same solver
+        bool paused;
+        int64_t conflicts;
         
         inline bool assigned() const { return solverId != -1; }
         inline bool done() const { return done_; /*assigned() && tSolve == NULL;*/ }
@@ -81,25 +85,96 @@ private:
     
     void stop(Task& task);
     void assignTasks();
-    lbool solveTask();
+    lbool solveTask(Task& task);
     
     struct Msg {
         friend ostream& operator<<(ostream& out, const Msg& msg) { return out << "[level=" << msg.level << "; assumptions=" << msg.assumptions << "; status=" << msg.status << "; upperbound=" << msg.upperbound << "; core=" << msg.core << "]"; }
-        inline Msg() : level(-1), status(l_Undef), upperbound(INT64_MAX) {}
-        inline Msg(const Task& task) : level(task.level), status(l_Undef), upperbound(INT64_MAX) { task.assumptions.copyTo(assumptions); }
-        inline Msg(const Msg& init) : level(init.level), status(init.status), upperbound(init.upperbound) { init.assumptions.copyTo(assumptions); init.core.copyTo(core); }
+        inline Msg() : level(-1), status(l_Undef), upperbound(INT64_MAX), paused(false) {}
+        inline Msg(const Task& task) : level(task.level), status(l_Undef), upperbound(INT64_MAX), paused(false) { task.assumptions.copyTo(assumptions); }
+        inline void swap(Msg& other) {
+            std::swap(level, other.level);
+            std::swap(status, other.status);
+            std::swap(upperbound, other.upperbound);
+            std::swap(paused, other.paused);
+            vec<Lit> tmp;
+            assumptions.moveTo(tmp); other.assumptions.moveTo(assumptions); tmp.moveTo(other.assumptions);
+            core.moveTo(tmp); other.core.moveTo(core); tmp.moveTo(other.core);
+        }
         int level;
         vec<Lit> assumptions;
         lbool status;
         vec<Lit> core;
         int64_t upperbound;
+        bool paused;
     };
-    list<Msg> msgs;
-    void add(const Msg& msg);
+    MsgQueue<Msg> msgs;
+    int pendingMsgs;
+    void add(Msg& msg);
+    
+    // deterministic mode: the messages of a round are processed by task, and clauses are imported only at barriers
+    vec<Msg> round;
+    int roundPos;
+    bool nextMsg(Msg& msg);
+    void barrier();
     
     friend void solveTask(void* solver_, void* task_);
     
-    thread* tSolve;
+    // persistent worker thread, waiting for the master to fill the task slot
+    thread* worker;
+    std::mutex slotLock;
+    std::condition_variable slotChanged;
+    Task* slot;
+    bool quit;
+    // set by the first interrupt, so that no model is copied while the best one is printed
+    std::atomic<bool> interrupted;
+    std::atomic<std::thread::id> copier;
+    void startWorker();
+    void stopWorker();
+    void work();
+    void post(Task* task);
+    void waitIdle();
+    
+    // learned clauses over variables known by all solvers are exported through a ring, read by the other solvers
+    ClauseRing exported;
+    vec<uint64_t> imported;
+    Var sharedVars;
+    vec<Lit> ringBuffer;
+    virtual void parallelExportUnaryClause(Lit p);
+    virtual void parallelExportClauseDuringSearch(Clause& c);
+    virtual bool parallelImportClauses();
+    bool importClauses();
+    bool importClause(vec<Lit>& lits);
+    
+    // input hard clauses, stored once by the master and only read by all solvers; clause i is lits[offsets[i]..offsets[i+1])
+    struct ClauseArena {
+        vec<Lit> lits;
+        vec<int> offsets;
+        inline int size() const { return offsets.size() - 1; }
+    };
+    struct ArenaWatch {
+        inline ArenaWatch() : clause(-1) {}
+        inline ArenaWatch(int clause_, Lit blocker_) : clause(clause_), blocker(blocker_) {}
+        int clause;
+        Lit blocker;
+    };
+    const ClauseArena* arena;
+    vec<vec<ArenaWatch> > arenaWatches;
+    // arena clauses cannot be reordered, so each solver keeps the positions of the two watched literals
+    vec<int> arenaWatched;
+    vec<int> moreReasonArena;
+    vec<Var> moreReasonArenaVars;
+    int moreConflictArena;
+    int nextToPropagateArena;
+    void moveClausesToArena();
+    void attachArena(const ClauseArena* arena);
+    void analyzeArenaLit(Lit q, vec<Lit>& out_learnt, vec<Lit>& selectors, int& pathC);
+    
+    virtual CRef morePropagate();
+    CRef propagateArena(Lit lit);
+    virtual bool moreReason(Lit lit, vec<Lit>& out_learnt, vec<Lit>& selectors, int& pathC);
+    virtual bool moreReason(Lit lit);
+    virtual bool moreConflict(vec<Lit>& out_learnt, vec<Lit>& selectors, int& pathC);
+    virtual void onCancel();
     
     int64_t budget;
     
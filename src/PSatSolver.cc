@@ -0,0 +1,347 @@
+/*
+ *  Copyright (C) 2017  Mario Alviano (mario@alviano.net)
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "PSatSolver.h"
+
+#include <mtl/Sort.h>
+
+extern Glucose::IntOption option_threads;
+extern Glucose::BoolOption option_print_model;
+
+Glucose::IntOption option_cube_depth("SAT", "cube-depth", "Depth of the lookahead tree splitting the formula in cubes, 0 for automatic (used by PSat).", 0, Glucose::IntRange(0, 30));
+
+namespace aspino {
+
+// number of unassigned variables, the most frequent ones, evaluated at each node of the lookahead tree
+static const int lookaheadCandidates = 32;
+
+struct OccurrencesGt {
+    const vec<int>& occurrences;
+    OccurrencesGt(const vec<int>& occurrences_) : occurrences(occurrences_) {}
+    bool operator()(Var a, Var b) const { return occurrences[a] > occurrences[b]; }
+};
+
+PSatSolver::PSatSolver(PSatSolver* master, int id_) : id(id_), stopped(false), winner(-1), unsolved(0), unsatisfiable(false), cubesBegin(0), cubesEnd(0), msgs(master == NULL ? 1024 : 1) {
+    setIncrementalMode();
+    if(master != NULL) solvers.push(master);
+    else {
+        solvers.push(this);
+        for(int i = 1; i < option_threads; i++) solvers.push(new PSatSolver(this, i));
+    }
+}
+
+PSatSolver::~PSatSolver() {
+    for(int i = 1; i < solvers.size(); i++) delete solvers[i];
+}
+
+void PSatSolver::interrupt() {
+    PSatSolver* master = solvers[0];
+    for(int i = 0; i < master->solvers.size(); i++) master->solvers[i]->Glucose::SimpSolver::interrupt();
+}
+
+void PSatSolver::clone(PSatSolver& other) {
+    assert(decisionLevel() == 0);
+    other.eliminate(true);
+    other.nInVars(nInVars());
+    while(other.nVars() < nVars()) {
+        Var v = other.nVars();
+        other.newVar();
+        if(isEliminated(v)) other.setDecisionVar(v, false);
+        else if(value(v) != l_Undef) other.addClause(mkLit(v, value(v) == l_False));
+    }
+
+    vec<Lit> lits;
+    for(int i = 0; i < clauses.size(); i++) {
+        Clause& clause = ca[clauses[i]];
+        for(int j = 0; j < clause.size(); j++) lits.push(clause[j]);
+        other.addClause_(lits);
+        lits.clear();
+    }
+}
+
+Lit PSatSolver::lookahead(bool& forced) {
+    forced = false;
+    Lit best = lit_Undef;
+    int64_t bestScore = -1;
+    int candidates = 0;
+    for(int i = 0; i < order.size() && candidates < lookaheadCandidates; i++) {
+        Var v = order[i];
+        if(value(v) != l_Undef) continue;
+        candidates++;
+
+        int64_t count[2];
+        for(int j = 0; j < 2; j++) {
+            newDecisionLevel();
+            uncheckedEnqueue(mkLit(v, j == 1));
+            count[j] = propagate() != CRef_Undef ? -1 : trail.size() - trail_lim.last();
+            cancelUntil(decisionLevel() - 1);
+        }
+
+        // failed literal: the other one is implied by the cube
+        if(count[0] == -1 || count[1] == -1) {
+            forced = true;
+            return count[0] == -1 ? mkLit(v, true) : mkLit(v);
+        }
+
+        int64_t score = (count[0] + 1) * (count[1] + 1);
+        if(score > bestScore) {
+            bestScore = score;
+            best = count[0] >= count[1] ? mkLit(v) : mkLit(v, true);
+        }
+    }
+    return best;
+}
+
+void PSatSolver::split(vec<Lit>& cube, int depth) {
+    assert(decisionLevel() == cube.size());
+    bool forced = false;
+    Lit p = depth == 0 ? lit_Undef : lookahead(forced);
+    if(p == lit_Undef) {
+        cubes.push();
+        cube.copyTo(cubes.last());
+        return;
+    }
+
+    for(int i = 0; i < (forced ? 1 : 2); i++) {
+        Lit q = i == 0 ? p : ~p;
+        cube.push(q);
+        newDecisionLevel();
+        uncheckedEnqueue(q);
+        if(propagate() != CRef_Undef) refuted(cube);
+        else split(cube, forced ? depth : depth - 1);
+        cancelUntil(decisionLevel() - 1);
+        cube.pop();
+    }
+}
+
+void PSatSolver::refuted(const vec<Lit>& lits) {
+    std::unique_lock<std::mutex> locker(lock);
+    for(int i = 0; i < lits.size(); i++) {
+        if(inCore[var(lits[i])]) continue;
+        inCore[var(lits[i])] = true;
+        core.push(lits[i]);
+    }
+}
+
+int PSatSolver::nextCube() {
+    std::unique_lock<std::mutex> locker(cubesLock);
+    if(cubesBegin < cubesEnd) return cubesBegin++;
+    locker.unlock();
+    return steal();
+}
+
+int PSatSolver::steal() {
+    PSatSolver* master = solvers[0];
+    for(;;) {
+        PSatSolver* victim = NULL;
+        int most = 0;
+        for(int i = 0; i < master->solvers.size(); i++) {
+            PSatSolver* solver = master->solvers[i];
+            if(solver == this) continue;
+            std::unique_lock<std::mutex> locker(solver->cubesLock);
+            if(solver->cubesEnd - solver->cubesBegin > most) { most = solver->cubesEnd - solver->cubesBegin; victim = solver; }
+        }
+        if(victim == NULL) return -1;
+
+        // take the second half of the victim range
+        std::unique_lock<std::mutex> locker(victim->cubesLock);
+        int left = victim->cubesEnd - victim->cubesBegin;
+        if(left <= 0) continue;
+        int end = victim->cubesEnd;
+        victim->cubesEnd -= (left + 1) / 2;
+        int begin = victim->cubesEnd;
+        locker.unlock();
+
+        trace(sat, 5, "[solver " << id << "] steal " << end - begin << " cubes from solver " << victim->id);
+        std::unique_lock<std::mutex> mine(cubesLock);
+        cubesBegin = begin + 1;
+        cubesEnd = end;
+        return begin;
+    }
+}
+
+void PSatSolver::work() {
+    PSatSolver* master = solvers[0];
+    vec<Lit> lits;
+    for(;;) {
+        if(master->stopped) return;
+        int c = nextCube();
+        if(c == -1) return;
+
+        master->cubes[c].copyTo(assumptions);
+        SatSolver::solve();
+        if(status == l_Undef) return;
+        if(status == l_True) {
+            std::unique_lock<std::mutex> locker(master->lock);
+            if(master->stopped) return;
+            master->winner = id;
+            master->stopped = true;
+            locker.unlock();
+            interrupt();
+            return;
+        }
+
+        assert(status == l_False);
+        master->unsolved--;
+        if(conflict.size() == 0) {
+            std::unique_lock<std::mutex> locker(master->lock);
+            master->unsatisfiable = true;
+            master->stopped = true;
+            locker.unlock();
+            interrupt();
+            return;
+        }
+        lits.clear();
+        for(int i = 0; i < conflict.size(); i++) lits.push(~conflict[i]);
+        master->refuted(lits);
+    }
+}
+
+bool PSatSolver::prepare() {
+    assert(id == 0);
+    cancelUntil(0);
+    if(!ok || !simplify()) return false;
+
+    for(int i = 1; i < solvers.size(); i++) clone(*solvers[i]);
+
+    occurrences.growTo(nVars(), 0);
+    for(int i = 0; i < clauses.size(); i++) {
+        Clause& clause = ca[clauses[i]];
+        for(int j = 0; j < clause.size(); j++) occurrences[var(clause[j])]++;
+    }
+    for(Var v = 0; v < nVars(); v++) if(!isEliminated(v) && value(v) == l_Undef) order.push(v);
+    Glucose::sort(order, OccurrencesGt(occurrences));
+
+    int depth = option_cube_depth;
+    if(depth == 0) {
+        depth = 4;
+        while((1 << (depth - 4)) < solvers.size()) depth++;
+    }
+    inCore.growTo(nVars(), false);
+    vec<Lit> cube;
+    split(cube, depth);
+    assert(decisionLevel() == 0);
+    trace(sat, 1, "Split in " << cubes.size() << " cubes at depth " << depth);
+    return true;
+}
+
+void PSatSolver::stopAll() {
+    solvers[0]->paths.stop();
+    interrupt();
+}
+
+lbool PSatSolver::onPathModel() {
+    // variables are frozen when enumerating, so no model extension is needed; the master owns the model printed
+    Msg msg;
+    if(option_print_model) for(int i = 0; i < nInVars(); i++) msg.model.push(value(i));
+    solvers[0]->msgs.push(msg);
+    return l_True;
+}
+
+void PSatSolver::enumerateWork() {
+    PSatSolver* master = solvers[0];
+    Msg msg;
+    msg.complete = enumeratePaths(master->paths, master->solvers.size());
+    if(!msg.complete) stopAll();
+    msg.done = true;
+    master->msgs.push(msg);
+}
+
+lbool PSatSolver::enumerate(int n) {
+    int count = 0;
+    if(prepare()) {
+        for(int i = 0; i < cubes.size(); i++) paths.give(cubes[i]);
+        vec<std::thread*> threads;
+        for(int i = 0; i < solvers.size(); i++) threads.push(new std::thread(&PSatSolver::enumerateWork, solvers[i]));
+
+        // models are printed here only, numbered in the order they arrive
+        int done = 0;
+        bool complete = true;
+        Msg msg;
+        while(done < solvers.size()) {
+            if(!msgs.pop(msg)) { msgs.wait(); continue; }
+            if(msg.done) {
+                done++;
+                if(!msg.complete) complete = false;
+                continue;
+            }
+            if(paths.isStopped()) continue;
+            // status is written by the thread of solver 0 until the end
+            if(++count == 1) cout << "s SATISFIABLE" << endl;
+            if(option_print_model) {
+                cout << "c Model " << count << endl;
+                msg.model.moveTo(model);
+                printModel();
+            }
+            if(count == n) stopAll();
+        }
+        for(int i = 0; i < threads.size(); i++) { threads[i]->join(); delete threads[i]; }
+        status = count > 0 ? l_True : complete ? l_False : l_Undef;
+    }
+    else status = l_False;
+
+    if(count == 0) printStatus();
+    cout << "c Models " << count << endl;
+    return status;
+}
+
+lbool PSatSolver::solve() {
+    if(!prepare()) { status = l_False; return status; }
+
+    unsolved = cubes.size();
+    for(int i = 0; i < solvers.size(); i++) {
+        solvers[i]->cubesBegin = static_cast<int64_t>(cubes.size()) * i / solvers.size();
+        solvers[i]->cubesEnd = static_cast<int64_t>(cubes.size()) * (i + 1) / solvers.size();
+    }
+    vec<std::thread*> threads;
+    for(int i = 1; i < solvers.size(); i++) threads.push(new std::thread(&PSatSolver::work, solvers[i]));
+    work();
+    for(int i = 0; i < threads.size(); i++) { threads[i]->join(); delete threads[i]; }
+
+    if(winner != -1) {
+        status = l_True;
+        if(winner == 0) copyModel();
+        else {
+            model.growTo(nVars());
+            for(int i = 0; i < nVars(); i++) model[i] = solvers[winner]->value(i);
+            Glucose::SimpSolver::extendModel();
+        }
+    }
+    else if(unsatisfiable || unsolved == 0) status = l_False;
+    else status = l_Undef;
+    return status;
+}
+
+lbool PSatSolver::solve(int n) {
+    if(n != 1) return enumerate(n);
+
+    solve();
+    printStatus();
+    if(status == l_True && option_print_model) {
+        cout << "c Model 1" << endl;
+        printModel();
+    }
+    if(status == l_False && !unsatisfiable && core.size() > 0) {
+        cout << "c Cube core:";
+        for(int i = 0; i < core.size(); i++) cout << " " << (sign(core[i]) ? "-" : "") << (var(core[i]) + 1);
+        cout << endl;
+    }
+    cout << "c Models " << (status == l_True ? 1 : 0) << endl;
+    return status;
+}
+
+} // namespace aspino
@@ -0,0 +1,98 @@
+/*
+ *  Copyright (C) 2017  Mario Alviano (mario@alviano.net)
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef __PSatSolver_h__
+#define __PSatSolver_h__
+
+#include "SatSolver.h"
+#include "utils/MsgQueue.h"
+#include "utils/GuidingPaths.h"
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+
+namespace aspino {
+
+// Cube-and-conquer: the master splits the formula into cubes by lookahead, and the cubes are solved as assumptions by a pool of clones.
+// Enumeration uses the cubes as guiding paths: each path is enumerated by assumptions, and idle solvers receive the unexplored branches of busy ones.
+class PSatSolver : public SatSolver {
+public:
+    PSatSolver(PSatSolver* master = NULL, int id = 0);
+    virtual ~PSatSolver();
+
+    virtual void interrupt();
+
+    virtual lbool solve();
+    virtual lbool solve(int n);
+
+private:
+    vec<PSatSolver*> solvers;
+    int id;
+
+    // master only
+    vec<vec<Lit> > cubes;
+    vec<int> occurrences;
+    vec<Var> order;
+    std::mutex lock;
+    std::atomic<bool> stopped;
+    int winner;
+    std::atomic<int> unsolved;
+    bool unsatisfiable;
+    vec<bool> inCore;
+    vec<Lit> core;
+    void clone(PSatSolver& other);
+    bool prepare();
+    void split(vec<Lit>& cube, int depth);
+    Lit lookahead(bool& forced);
+    void refuted(const vec<Lit>& lits);
+
+    // cubes still to solve are [cubesBegin, cubesEnd); other solvers steal from the end
+    std::mutex cubesLock;
+    int cubesBegin;
+    int cubesEnd;
+    int nextCube();
+    int steal();
+
+    void work();
+
+    // enumeration: the cubes are the initial guiding paths, models are sent to the master that prints them
+    GuidingPaths paths;
+    void stopAll();
+
+    struct Msg {
+        inline Msg() : done(false), complete(false) {}
+        inline void swap(Msg& other) {
+            std::swap(done, other.done);
+            std::swap(complete, other.complete);
+            vec<lbool> tmp;
+            model.moveTo(tmp); other.model.moveTo(model); tmp.moveTo(other.model);
+        }
+        vec<lbool> model;
+        bool done;      // last message of a solver
+        bool complete;  // the solver enumerated all models of its paths
+    };
+    MsgQueue<Msg> msgs;
+
+    virtual lbool onPathModel();
+    void enumerateWork();
+    lbool enumerate(int n);
+};
+
+} // namespace aspino
+
+#endif
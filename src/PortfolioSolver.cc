@@ -0,0 +1,208 @@
+/*
+ *  Copyright (C) 2017  Mario Alviano (mario@alviano.net)
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "PortfolioSolver.h"
+
+extern Glucose::IntOption option_threads;
+extern Glucose::BoolOption option_maxsat_printmodel;
+
+namespace aspino {
+
+// thread 0 uses the configuration given on the command line, the others cycle over this list
+static const struct { const char* corestrat; const char* disjcores; } configurations[] = {
+    {"kdyn", "pre"},
+    {"pmres", "pre"},
+    {"one-wc", "no"},
+    {"pmres-log", "pre"},
+    {"one-neg", "wce"},
+    {"wone", "pre"},
+    {"one-pmres", "all"},
+    {"pmres-split-conj", "pre"},
+};
+static const int numberOfConfigurations = sizeof(configurations) / sizeof(configurations[0]);
+
+PortfolioSolver::PortfolioSolver() : lowerbound(0), upperbound(INT64_MAX), inVars(0), status(l_Undef), stopped(false) {
+    int n = option_threads > 0 ? static_cast<int>(option_threads) : 1;
+    for(int i = 0; i < n; i++) {
+        solvers.push(new MaxSatSolver());
+        solvers.last()->portfolio = this;
+        configure(*solvers.last(), i);
+    }
+}
+
+PortfolioSolver::~PortfolioSolver() {
+    std::unique_lock<std::mutex> locker(lock);
+    stop();
+    locker.unlock();
+    for(int i = 0; i < threads.size(); i++) { threads[i]->join(); delete threads[i]; }
+    for(int i = 0; i < solvers.size(); i++) delete solvers[i];
+}
+
+void PortfolioSolver::configure(MaxSatSolver& solver, int index) {
+    if(index == 0) return;
+    int i = (index - 1) % numberOfConfigurations;
+    solver.setCoreStrategy(configurations[i].corestrat);
+    solver.setDisjunctCores(configurations[i].disjcores);
+    solver.random_seed += index;
+    // repeated configurations are diversified by random decisions
+    if(index > numberOfConfigurations) solver.random_var_freq = 0.01;
+    trace(maxsat, 1, "Thread " << index << ": corestrat " << configurations[i].corestrat << ", disjcores " << configurations[i].disjcores);
+}
+
+void PortfolioSolver::copy(MaxSatSolver& from, MaxSatSolver& to) {
+    assert(from.decisionLevel() == 0);
+    to.nInVars(from.nInVars());
+    to.inClauses = from.inClauses;
+    while(to.nVars() < from.nVars()) {
+        Var v = to.nVars();
+        to.newVar();
+        to.weights.push(0);
+        if(from.frozen[v]) to.setFrozen(v, true);
+        if(from.value(v) != l_Undef) to.addClause(mkLit(v, from.value(v) == l_False));
+    }
+
+    vec<Lit> lits;
+    for(int i = 0; i < from.clauses.size(); i++) {
+        Clause& clause = from.ca[from.clauses[i]];
+        for(int j = 0; j < clause.size(); j++) lits.push(clause[j]);
+        to.addClause_(lits);
+        lits.clear();
+    }
+
+    for(int i = 0; i < from.softLiterals.size(); i++) {
+        lits.push(from.softLiterals[i]);
+        to.addWeightedClause(lits, from.weights[var(from.softLiterals[i])]);
+        lits.clear();
+    }
+    to.lowerbound = from.lowerbound;
+}
+
+void PortfolioSolver::parse(gzFile in) {
+    solvers[0]->parse(in);
+    inVars = solvers[0]->nInVars();
+
+    // bounds of different levels are not comparable, so lexicographic optimization runs the first configuration only
+    if(solvers[0]->lexicographic) {
+        solvers[0]->portfolio = NULL;
+        for(int i = 1; i < solvers.size(); i++) delete solvers[i];
+        solvers.shrink_(solvers.size() - 1);
+        return;
+    }
+
+    for(int i = 1; i < solvers.size(); i++) copy(*solvers[0], *solvers[i]);
+}
+
+bool PortfolioSolver::simplify() {
+    for(int i = 0; i < solvers.size(); i++) if(!solvers[i]->simplify()) return false;
+    return true;
+}
+
+bool PortfolioSolver::eliminate(bool turn_off_elim) {
+    for(int i = 0; i < solvers.size(); i++) if(!solvers[i]->eliminate(turn_off_elim)) return false;
+    return true;
+}
+
+bool PortfolioSolver::okay() const {
+    return solvers[0]->okay();
+}
+
+void PortfolioSolver::interrupt() {
+    std::unique_lock<std::mutex> locker(lock);
+    // the search is over, and the main thread prints the result
+    if(stopped) return;
+    if(upperbound == INT64_MAX) cout << "s UNKNOWN" << endl;
+    else {
+        cout << "s SATISFIABLE" << endl;
+        if(option_maxsat_printmodel) printModel();
+    }
+    this->exit(1);
+}
+
+void PortfolioSolver::run(int index) {
+    lbool ret;
+    try { ret = solvers[index]->optimize(); }
+    catch(Stop&) { return; }
+    catch(Glucose::OutOfMemoryException&) { interrupt(); return; }
+    done(ret);
+}
+
+lbool PortfolioSolver::solve() {
+    if(solvers[0]->portfolio == NULL) return solvers[0]->solve();
+
+    std::unique_lock<std::mutex> locker(lock);
+    for(int i = 0; i < solvers.size(); i++) threads.push(new std::thread(&PortfolioSolver::run, this, i));
+    finished.wait(locker, [this](){ return stopped.load(); });
+
+    if(status == l_False) { cout << "s UNSATISFIABLE" << endl; return l_False; }
+    assert(status == l_True);
+    cout << "o " << upperbound << endl;
+    cout << "s OPTIMUM FOUND" << endl;
+    if(option_maxsat_printmodel) printModel();
+    return l_True;
+}
+
+void PortfolioSolver::updateLowerBound(int64_t value) {
+    std::unique_lock<std::mutex> locker(lock);
+    if(stopped || value <= lowerbound) return;
+    lowerbound = value;
+    if(proven()) { status = l_True; stop(); return; }
+    cout << "o " << lowerbound << endl;
+}
+
+void PortfolioSolver::updateUpperBound(MaxSatSolver& solver) {
+    std::unique_lock<std::mutex> locker(lock);
+    if(stopped || solver.upperbound >= upperbound) return;
+    upperbound = solver.upperbound;
+    solver.model.copyTo(model);
+    cout << "c " << upperbound << " ub" << endl;
+    if(proven()) { status = l_True; stop(); }
+}
+
+void PortfolioSolver::sync(MaxSatSolver& solver) {
+    if(stopped) throw Stop();
+    // the model of the shared upper bound is stored here, so the solver can use the bound for hardening
+    int64_t ub = upperbound;
+    if(ub < solver.upperbound) solver.upperbound = ub;
+}
+
+void PortfolioSolver::done(lbool result) {
+    std::unique_lock<std::mutex> locker(lock);
+    if(stopped) return;
+    assert(result != l_True || upperbound != INT64_MAX);
+    status = result;
+    stop();
+}
+
+bool PortfolioSolver::proven() const {
+    return upperbound != INT64_MAX && lowerbound >= upperbound;
+}
+
+void PortfolioSolver::stop() {
+    stopped = true;
+    for(int i = 0; i < solvers.size(); i++) solvers[i]->asynch_interrupt = true;
+    finished.notify_all();
+}
+
+void PortfolioSolver::printModel() const {
+    assert(model.size() >= inVars);
+    cout << "v";
+    for(int i = 0; i < inVars; i++)
+        cout << " " << (model[i] == l_False ? "-" : "") << (i+1);
+    cout << endl;
+}
+
+} // namespace aspino
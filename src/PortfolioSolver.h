@@ -0,0 +1,80 @@
+/*
+ *  Copyright (C) 2017  Mario Alviano (mario@alviano.net)
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef __PortfolioSolver_h__
+#define __PortfolioSolver_h__
+
+#include "MaxSatSolver.h"
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace aspino {
+
+// Runs several configurations of MaxSatSolver in threads.
+// Bounds and the best model are shared, and the first thread proving optimality terminates the search.
+class PortfolioSolver : public AbstractSolver {
+    friend class MaxSatSolver;
+public:
+    PortfolioSolver();
+    virtual ~PortfolioSolver();
+
+    virtual void interrupt();
+
+    virtual void parse(gzFile in);
+    virtual bool simplify();
+    virtual bool eliminate(bool turn_off_elim);
+    virtual bool okay() const;
+    virtual lbool solve();
+    virtual lbool solve(int) { return solve(); }
+
+private:
+    vec<MaxSatSolver*> solvers;
+    vec<std::thread*> threads;
+
+    std::mutex lock;
+    std::condition_variable finished;
+    int64_t lowerbound;
+    std::atomic<int64_t> upperbound;
+    vec<lbool> model;
+    int inVars;
+    lbool status;
+    std::atomic<bool> stopped;
+
+    // thrown in the threads that are still running when the search is over
+    struct Stop {};
+
+    void configure(MaxSatSolver& solver, int index);
+    void copy(MaxSatSolver& from, MaxSatSolver& to);
+    void run(int index);
+
+    // called by solvers
+    void updateLowerBound(int64_t value);
+    void updateUpperBound(MaxSatSolver& solver);
+    void sync(MaxSatSolver& solver);
+    void done(lbool result);
+
+    bool proven() const;
+    void stop();
+    void printModel() const;
+};
+
+} // namespace aspino
+
+#endif
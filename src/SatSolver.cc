@@ -19,6 +19,7 @@
 
 #include "utils/algorithm.h"
 #include "utils/ParseUtils.h"
+#include "utils/GuidingPaths.h"
 #include "core/Dimacs.h"
 
 #include <iostream>
@@ -78,11 +79,32 @@ lbool SatSolver::solve() {
 
     solves++;
 
-    solve_();
+    if(hardAssumptions.size() == 0) solve_();
+    else solveUnderHardAssumptions();
 
     return status;
 }
 
+void SatSolver::solveUnderHardAssumptions() {
+    vec<Lit> tmp;
+    assumptions.moveTo(tmp);
+    hardAssumptions.copyTo(assumptions);
+    for(int i = 0; i < tmp.size(); i++) assumptions.push(tmp[i]);
+    solve_();
+    tmp.moveTo(assumptions);
+    if(status != l_False) return;
+    
+    for(int i = 0; i < hardAssumptions.size(); i++) seen[var(hardAssumptions[i])] = 1;
+    int j = 0;
+    for(int i = 0; i < conflict.size(); i++) {
+        if(seen[var(conflict[i])]) continue;
+        conflict[j++] = conflict[i];
+    }
+    if(j < conflict.size()) conflictOnHardAssumptions = true;
+    conflict.shrink_(conflict.size() - j);
+    for(int i = 0; i < hardAssumptions.size(); i++) seen[var(hardAssumptions[i])] = 0;
+}
+
 lbool SatSolver::solve(int n) {
     if(strcmp(option_sat_enumeration, "assumptions") == 0) return enumerateByAssumption(n);
     if(strcmp(option_sat_enumeration, "blocking-clauses") == 0) return enumerateByBlockingClauses(n);
@@ -184,6 +206,77 @@ lbool SatSolver::enumerateByAssumption(int n) {
     return ret;
 }
 
+bool SatSolver::enumeratePath(const vec<Lit>& path, GuidingPaths* pool) {
+    cancelUntil(0);
+
+    int nAss = path.size();
+    vec<Lit> branchingLits;
+    vec<bool> branchingFlags;
+
+    for(;;) {
+        path.copyTo(assumptions);
+        for(int i = 0; i < branchingLits.size(); i++) assumptions.push(branchingLits[i]);
+
+        solve_();
+        if(status == l_Undef) return false;
+
+        if(status == l_True) {
+            lbool res = onPathModel();
+            if(res == l_False) return true;
+            if(res == l_Undef) { assert(branchingLits.size() == 0); continue; }
+            for(int i = assumptions.size(); i < decisionLevel(); i++) {
+                branchingLits.push(mainTrail(mainTrailLimit(i)));
+                branchingFlags.push(false);
+            }
+        }
+        else {
+            assert(status == l_False);
+            // backjump
+            Var v = conflict.size() > 0 ? var(conflict[0]) : -1;
+            while(branchingLits.size() > 0 && v != var(branchingLits.last())) {
+                branchingLits.pop();
+                branchingFlags.pop();
+            }
+        }
+
+        // the shallowest branch not yet flipped is the largest part of the path to give away; flagged, it is popped instead of flipped
+        if(pool != NULL && pool->waiting()) {
+            for(int i = 0; i < branchingLits.size(); i++) {
+                if(branchingFlags[i]) continue;
+                vec<Lit> lits;
+                path.copyTo(lits);
+                for(int j = 0; j < i; j++) lits.push(branchingLits[j]);
+                lits.push(~branchingLits[i]);
+                branchingFlags[i] = true;
+                trace(sat, 5, "Give path of length " << lits.size());
+                pool->give(lits);
+                break;
+            }
+        }
+
+        // remove flipped branching literals
+        while(branchingLits.size() > 0 && branchingFlags.last()) {
+            branchingLits.pop();
+            branchingFlags.pop();
+        }
+
+        if(branchingLits.size() == 0) return true;
+
+        // flip top branching literal
+        branchingLits.last() = ~branchingLits.last();
+        branchingFlags.last() = true;
+
+        // decision levels match assumptions of the last call
+        cancelUntil(nAss + branchingLits.size() - 1);
+    }
+}
+
+bool SatSolver::enumeratePaths(GuidingPaths& pool, int solvers) {
+    vec<Lit> path;
+    while(pool.take(path, solvers)) if(!enumeratePath(path, &pool)) return false;
+    return !pool.isStopped();
+}
+
 
 void SatSolver::quickSort(int left, int right) {
     int i = left, j = right;
@@ -215,6 +308,8 @@ void SatSolver::quickSort(int left, int right) {
 }
 
 void SatSolver::solve_() {
+    // a core left by a previous call would hide a conflict at level 0
+    conflict.clear();
     if(!ok) { status = l_False; return; }
 
     status = l_Undef;
@@ -247,6 +342,12 @@ lbool SatSolver::search(int)
     bool blocked=false;
     starts++;
     for (;;){
+        if (decisionLevel() == 0) {
+            // clauses learned by other solvers, if any
+            parallelImportUnaryClauses();
+            if (parallelImportClauses()) return l_False;
+        }
+        
         CRef confl;
         do {
             confl = propagate();
@@ -293,6 +394,7 @@ lbool SatSolver::search(int)
 
             if (learnt_clause.size() == 1){
 	      uncheckedEnqueue(learnt_clause[0]);nbUn++;
+	      parallelExportUnaryClause(learnt_clause[0]);
             }else{
                 CRef cr = ca.alloc(learnt_clause, true);
 		ca[cr].setLBD(nblevels); 
@@ -304,12 +406,14 @@ lbool SatSolver::search(int)
 
                 claBumpActivity(ca[cr]);
                 uncheckedEnqueue(learnt_clause[0], cr);
+                parallelExportClauseDuringSearch(ca[cr]);
             }
             varDecayActivity();
             claDecayActivity();
 
            
         }else{
+	  if(limitReached) interrupt();
 	  // Our dynamic restart, see the SAT09 competition compagnion paper 
 	  if ( asynch_interrupt || // ADDED BY MALVI
 	      ( lbdQueue.isvalid() && ((lbdQueue.getavg()*K) > (sumLBD / conflictsRestarts)))) {
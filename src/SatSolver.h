@@ -23,9 +23,11 @@
 
 namespace aspino {
 
+class GuidingPaths;
+
 class SatSolver : public AbstractSolver, protected Glucose::SimpSolver {
 public:
-    SatSolver() : inVars(0), status(l_Undef) { certifiedUNSAT = false; parsing = false;}
+    SatSolver() : inVars(0), status(l_Undef), conflictOnHardAssumptions(false) { certifiedUNSAT = false; parsing = false;}
     virtual ~SatSolver() {}
     
     virtual void interrupt() { Glucose::SimpSolver::interrupt(); }
@@ -70,12 +72,25 @@ protected:
     static double luby(double y, int x);
     void learnClauseFromModel();
     
+    // enumerates the models extending path by flipping branching literals as assumptions; unexplored branches are given to idle solvers of pool, if any.
+    // Returns false if interrupted.
+    bool enumeratePath(const vec<Lit>& path, GuidingPaths* pool);
+    // called on each model of enumeratePath: l_True to continue, l_Undef to solve the path again without branching literals, l_False to stop
+    virtual inline lbool onPathModel() { return l_True; }
+    // enumerates the paths taken from pool until all solvers are idle; false if the enumeration is incomplete
+    bool enumeratePaths(GuidingPaths& pool, int solvers);
+    
     int inVars;
     int inClauses;
     lbool status;
     bool sortAssumptions;
     
+    // assumed before the assumptions of every call to solve(), and removed from the returned conflict
+    vec<Lit> hardAssumptions;
+    bool conflictOnHardAssumptions;
+    
 private:
+    void solveUnderHardAssumptions();
     lbool enumerateByBlockingClauses(int n);
     lbool enumerateByAssumption(int n);
 };
@@ -17,7 +17,7 @@
 
 #include "main.h"
 
-Glucose::EnumOption option_mode("MAIN", "mode", "How to interpret input.\n", "asp|sat|maxsat|pmaxsat|pbs|qbf|circumscription|fairsat|ltl|tgds");
+Glucose::EnumOption option_mode("MAIN", "mode", "How to interpret input.\n", "asp|sat|psat|maxsat|pmaxsat|portfolio|pbs|qbf|circumscription|fairsat|ltl|tgds");
 Glucose::IntOption option_n("MAIN", "n", "Number of desired solutions. Non-positive integers are interpreted as unbounded.\n", 1, Glucose::IntRange(0, INT32_MAX));
 
 Glucose::BoolOption option_print_model("MAIN", "print-model", "Print model if found.", true);
@@ -27,11 +27,50 @@ Glucose::IntOption mem_lim("MAIN", "mem-lim","Limit on memory usage in megabytes
 
 aspino::AbstractSolver* solver = NULL;
 
+// released when memory is exhausted, so that the best model can still be printed
+static const int memoryReserveSize = 16 * 1024 * 1024;
+static char* memoryReserve = NULL;
+
 void SIGINT_interrupt(int) { solver->interrupt(); }
 
+void SIGXCPU_interrupt(int) {
+    // SIGXCPU is sent every second after the limit: interrupt now if the solver did not reach a safe point in the meantime
+    if(AbstractSolver::limitReached) solver->interrupt();
+    AbstractSolver::limitReached = true;
+}
+
+static void setResourceLimits() {
+    rlimit rl;
+    if(cpu_lim != INT32_MAX) {
+        getrlimit(RLIMIT_CPU, &rl);
+        if(rl.rlim_max == RLIM_INFINITY || static_cast<rlim_t>(cpu_lim) < rl.rlim_max) {
+            rl.rlim_cur = cpu_lim;
+            if(setrlimit(RLIMIT_CPU, &rl) == -1) cerr << "WARNING! Could not set resource limit: CPU-time." << endl;
+        }
+    }
+    if(mem_lim != INT32_MAX) {
+        rlim_t limit = static_cast<rlim_t>(mem_lim) * 1024 * 1024;
+        getrlimit(RLIMIT_AS, &rl);
+        if(rl.rlim_max == RLIM_INFINITY || limit < rl.rlim_max) {
+            rl.rlim_cur = limit;
+            if(setrlimit(RLIMIT_AS, &rl) == -1) cerr << "WARNING! Could not set resource limit: Virtual memory." << endl;
+        }
+        memoryReserve = new char[memoryReserveSize];
+    }
+}
+
+static lbool outOfMemory() {
+    delete[] memoryReserve;
+    memoryReserve = NULL;
+    solver->interrupt();
+    cout << "s UNKNOWN" << endl;
+    return l_Undef;
+}
+
 void premain() {
     signal(SIGINT, SIGINT_interrupt);
     signal(SIGTERM, SIGINT_interrupt);
+    signal(SIGXCPU, SIGXCPU_interrupt);
 
     Glucose::setUsageHelp(
         "Solve ASP or SAT problems read from STDIN or provided as command-line argument.\n\n"
@@ -49,10 +88,14 @@ int postmain(int argc, char** argv) {
         solver = new AspSolver();
     else if(strcmp(option_mode, "sat") == 0)
         solver = new SatSolver();
+    else if(strcmp(option_mode, "psat") == 0)
+        solver = new PSatSolver();
     else if(strcmp(option_mode, "maxsat") == 0)
         solver = new MaxSatSolver();
     else if(strcmp(option_mode, "pmaxsat") == 0)
         solver = new PMaxSatSolver();
+    else if(strcmp(option_mode, "portfolio") == 0)
+        solver = new PortfolioSolver();
     else if(strcmp(option_mode, "pbs") == 0)
         solver = new PseudoBooleanSolver();
     else if(strcmp(option_mode, "qbf") == 0)
@@ -73,17 +116,24 @@ int postmain(int argc, char** argv) {
         solver->exit(-1);
     }
 
-    gzFile in = argc == 1 ? gzdopen(0, "rb") : gzopen(argv[1], "rb");
-    solver->parse(in);
-    gzclose(in);
+    setResourceLimits();
 
-    solver->eliminate(true);
-    if(!solver->okay()) {
-        cout << "UNSATISFIABLE" << endl;
-        solver->exit(20);
+    lbool ret;
+    try {
+        gzFile in = argc == 1 ? gzdopen(0, "rb") : gzopen(argv[1], "rb");
+        solver->parse(in);
+        gzclose(in);
+
+        solver->eliminate(true);
+        if(!solver->okay()) {
+            cout << "UNSATISFIABLE" << endl;
+            solver->exit(20);
+        }
+        
+        ret = solver->solve(option_n);
     }
-    
-    lbool ret = solver->solve(option_n);
+    catch(Glucose::OutOfMemoryException&) { ret = outOfMemory(); }
+    catch(std::bad_alloc&) { ret = outOfMemory(); }
     
 #ifndef SAFE_EXIT
     solver->exit(ret == l_True ? 10 : ret == l_False ? 20 : 0);     // (faster than "return", which will invoke the destructor for 'Solver')
@@ -20,9 +20,11 @@
 
 #include "AbstractSolver.h"
 #include "SatSolver.h"
+#include "PSatSolver.h"
 #include "PseudoBooleanSolver.h"
 #include "MaxSatSolver.h"
 #include "PMaxSatSolver.h"
+#include "PortfolioSolver.h"
 #include "2QBFSolver.h"
 #include "CircumscriptionSolver.h"
 #include "AspSolver.h"
@@ -35,6 +37,7 @@
 
 #include <errno.h>
 #include <signal.h>
+#include <sys/resource.h>
 #include <zlib.h>
 
 #include <string>
@@ -55,6 +58,7 @@ extern Glucose::IntOption mem_lim;
 extern aspino::AbstractSolver* solver;
 
 void SIGINT_interrupt(int);
+void SIGXCPU_interrupt(int);
 
 void premain();
 int postmain(int argc, char** argv);
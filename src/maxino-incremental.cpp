@@ -0,0 +1,108 @@
+/*
+ *  Copyright (C) 2014  Mario Alviano (mario@alviano.net)
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "main.h"
+
+#include <utils/ParseUtils.h>
+
+// Driver of the incremental interface of MaxSatSolver. The input is a sequence of commands:
+//   h <lits> 0             add a hard clause
+//   s <weight> <lits> 0    add a soft clause; soft clauses are numbered from 1 in order of addition
+//   r <index>              remove a soft clause
+//   a <lits> 0             solve under the given assumptions, and print the optimum and a model
+// Input variables are mapped to fresh solver variables, as the solver creates its own for soft clauses.
+
+static vec<Var> varmap;
+
+static Lit parseLit(MaxSatSolver& s, int parsed) {
+    int v = abs(parsed) - 1;
+    while(varmap.size() <= v) varmap.push(var_Undef);
+    if(varmap[v] == var_Undef) { varmap[v] = s.nVars(); s.newVar(); }
+    return mkLit(varmap[v], parsed < 0);
+}
+
+template<class B>
+static void parseLits(B& in, MaxSatSolver& s, vec<Lit>& lits) {
+    lits.clear();
+    for(;;) {
+        int parsed = parseInt(in);
+        if(parsed == 0) break;
+        lits.push(parseLit(s, parsed));
+    }
+}
+
+static void printResult(MaxSatSolver& s, lbool ret) {
+    if(ret == l_False) { cout << "s UNSATISFIABLE" << endl; return; }
+    if(ret != l_True) { cout << "s UNKNOWN" << endl; return; }
+    cout << "o " << s.getUpperBound() << endl;
+    cout << "s OPTIMUM FOUND" << endl;
+    cout << "v";
+    for(int i = 0; i < varmap.size(); i++) {
+        bool truth = varmap[i] != var_Undef && s.model[varmap[i]] == l_True;
+        cout << " " << (truth ? "" : "-") << (i+1);
+    }
+    cout << endl;
+}
+
+int main(int argc, char** argv)
+{
+    premain();
+
+    Glucose::parseOptions(argc, argv, true);
+    if(argc > 2) {
+        cerr << "Extra argument: " << argv[2] << endl;
+        exit(-1);
+    }
+
+    MaxSatSolver* s = new MaxSatSolver(true);
+    solver = s;
+
+    gzFile file = argc == 1 ? gzdopen(0, "rb") : gzopen(argv[1], "rb");
+    Glucose::StreamBuffer in(file);
+    vec<Lit> lits;
+    int softs = 0;
+    for(;;) {
+        skipWhitespace(in);
+        if(*in == EOF) break;
+        if(*in == 'c') { skipLine(in); continue; }
+        char cmd = *in;
+        ++in;
+        if(cmd == 'h') {
+            parseLits(in, *s, lits);
+            s->addHardClause(lits);
+        }
+        else if(cmd == 's') {
+            int64_t weight = parseLong(in);
+            parseLits(in, *s, lits);
+            s->addSoftClause(lits, weight);
+            softs++;
+        }
+        else if(cmd == 'r') {
+            int index = parseInt(in);
+            if(index < 1 || index > softs) cerr << "PARSE ERROR! Unknown soft clause: " << index << endl, exit(3);
+            s->removeSoftClause(index - 1);
+        }
+        else if(cmd == 'a') {
+            parseLits(in, *s, lits);
+            printResult(*s, s->solve(lits));
+        }
+        else cerr << "PARSE ERROR! Unexpected char: " << cmd << endl, exit(3);
+    }
+    gzclose(file);
+
+    return 0;
+}
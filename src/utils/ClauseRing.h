@@ -0,0 +1,82 @@
+/*
+ *  Copyright (C) 2017  Mario Alviano (mario@alviano.net)
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef __ClauseRing_h__
+#define __ClauseRing_h__
+
+#include <atomic>
+#include <stdint.h>
+
+#include "mtl/Vec.h"
+#include "core/SolverTypes.h"
+
+namespace aspino {
+
+// Lock-free ring of clauses with one writer and any number of readers, each one with its own position.
+// The writer never waits: records not read in time are overwritten, and readers skip them.
+class ClauseRing {
+public:
+    static const int maxClauseSize = 64;
+
+    ClauseRing(int log2capacity = 18) : head(0), capacity(1 << log2capacity), mask(capacity - 1), data(new std::atomic<int>[capacity]) {}
+    ~ClauseRing() { delete[] data; }
+
+    inline uint64_t position() const { return head.load(std::memory_order_acquire); }
+
+    // writer only; clauses are stored as [size, lits...]
+    inline bool push(const Glucose::Lit* lits, int size) {
+        if(size > maxClauseSize) return false;
+        uint64_t h = head.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        data[h & mask].store(size, std::memory_order_relaxed);
+        for(int i = 0; i < size; i++) data[(h + 1 + i) & mask].store(Glucose::toInt(lits[i]), std::memory_order_relaxed);
+        head.store(h + 1 + size, std::memory_order_release);
+        return true;
+    }
+
+    // copy in out the clause at pos and move pos to the next one; false if there is nothing (valid) to read
+    inline bool pop(uint64_t& pos, Glucose::vec<Glucose::Lit>& out) {
+        uint64_t h = head.load(std::memory_order_acquire);
+        if(pos == h) return false;
+        if(!valid(pos, h)) { pos = h; return false; }
+
+        int size = data[pos & mask].load(std::memory_order_relaxed);
+        out.clear();
+        if(size > 0 && size <= maxClauseSize && pos + 1 + size <= h)
+            for(int i = 0; i < size; i++) out.push(Glucose::toLit(data[(pos + 1 + i) & mask].load(std::memory_order_relaxed)));
+
+        // the record may have been overwritten while copying it
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t h2 = head.load(std::memory_order_relaxed);
+        if(out.size() == 0 || !valid(pos, h2)) { pos = h2; return false; }
+        pos += 1 + size;
+        return true;
+    }
+
+private:
+    std::atomic<uint64_t> head;
+    const uint64_t capacity;
+    const uint64_t mask;
+    std::atomic<int>* data;
+
+    // the record at pos is safe if the writer cannot be writing over it, even if it is in the middle of a push
+    inline bool valid(uint64_t pos, uint64_t h) const { return h + 1 + maxClauseSize <= pos + capacity; }
+};
+
+} // namespace aspino
+
+#endif
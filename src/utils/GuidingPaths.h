@@ -0,0 +1,74 @@
+/*
+ *  Copyright (C) 2017  Mario Alviano (mario@alviano.net)
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef __GuidingPaths_h__
+#define __GuidingPaths_h__
+
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+#include "mtl/Vec.h"
+#include "core/SolverTypes.h"
+
+namespace aspino {
+
+// Pool of guiding paths shared by the solvers of a parallel enumeration.
+// Idle solvers wait for the paths given away by busy ones; the enumeration is over when all solvers are idle and no path is left.
+class GuidingPaths {
+public:
+    GuidingPaths() : idle(0), stopped(false) {}
+
+    inline int size() const { return paths.size(); }
+    inline bool waiting() const { return idle > 0; }
+    inline bool isStopped() const { return stopped; }
+
+    bool take(Glucose::vec<Glucose::Lit>& path, int solvers) {
+        std::unique_lock<std::mutex> locker(lock);
+        idle++;
+        changed.wait(locker, [this, solvers](){ return stopped || paths.size() > 0 || idle == solvers; });
+        if(stopped || paths.size() == 0) { changed.notify_all(); return false; }
+        idle--;
+        paths.last().moveTo(path);
+        paths.pop();
+        return true;
+    }
+
+    void give(const Glucose::vec<Glucose::Lit>& path) {
+        std::unique_lock<std::mutex> locker(lock);
+        paths.push();
+        path.copyTo(paths.last());
+        changed.notify_one();
+    }
+
+    void stop() {
+        std::unique_lock<std::mutex> locker(lock);
+        stopped = true;
+        changed.notify_all();
+    }
+
+private:
+    Glucose::vec<Glucose::vec<Glucose::Lit> > paths;
+    std::mutex lock;
+    std::condition_variable changed;
+    std::atomic<int> idle;
+    std::atomic<bool> stopped;
+};
+
+} // namespace aspino
+
+#endif
@@ -0,0 +1,113 @@
+/*
+ *  Copyright (C) 2017  Mario Alviano (mario@alviano.net)
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#ifndef __MsgQueue_h__
+#define __MsgQueue_h__
+
+#include <atomic>
+#include <thread>
+#include <stdint.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace aspino {
+
+// Bounded lock-free queue with many producers and one consumer.
+// Slots are allocated once; messages are exchanged with T::swap(T&), so buffers of T are recycled instead of copied.
+template <class T>
+class MsgQueue {
+public:
+    MsgQueue(int minCapacity) : capacity(1), tail(0), head(0), signal(0), waiting(false) {
+        while(capacity < static_cast<uint64_t>(minCapacity)) capacity *= 2;
+        mask = capacity - 1;
+        slots = new Slot[capacity];
+        for(uint64_t i = 0; i < capacity; i++) slots[i].seq.store(i, std::memory_order_relaxed);
+    }
+    ~MsgQueue() { delete[] slots; }
+
+    // producers; msg receives the (cleared or stale) content of the slot
+    void push(T& msg) {
+        uint64_t pos = tail.load(std::memory_order_relaxed);
+        Slot* slot;
+        for(;;) {
+            slot = &slots[pos & mask];
+            int64_t diff = static_cast<int64_t>(slot->seq.load(std::memory_order_acquire)) - static_cast<int64_t>(pos);
+            if(diff == 0) { if(tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break; }
+            else if(diff < 0) { std::this_thread::yield(); pos = tail.load(std::memory_order_relaxed); } // full
+            else pos = tail.load(std::memory_order_relaxed);
+        }
+        slot->msg.swap(msg);
+        slot->seq.store(pos + 1, std::memory_order_release);
+
+        signal.fetch_add(1, std::memory_order_seq_cst);
+        if(waiting.load(std::memory_order_seq_cst)) wake();
+    }
+
+    // consumer only
+    inline bool empty() const { return slots[head & mask].seq.load(std::memory_order_acquire) != head + 1; }
+
+    bool pop(T& msg) {
+        Slot& slot = slots[head & mask];
+        if(slot.seq.load(std::memory_order_acquire) != head + 1) return false;
+        msg.swap(slot.msg);
+        slot.seq.store(head + capacity, std::memory_order_release);
+        head++;
+        return true;
+    }
+
+    void wait() {
+        for(;;) {
+            waiting.store(true, std::memory_order_seq_cst);
+            int value = signal.load(std::memory_order_seq_cst);
+            if(!empty()) break;
+            sleep(value);
+        }
+        waiting.store(false, std::memory_order_relaxed);
+    }
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> seq;
+        T msg;
+    };
+
+    uint64_t capacity;
+    uint64_t mask;
+    Slot* slots;
+    std::atomic<uint64_t> tail;
+    uint64_t head;
+
+    // incremented at each push, so that the consumer does not sleep if something arrived after its last check
+    std::atomic<int> signal;
+    std::atomic<bool> waiting;
+
+#ifdef __linux__
+    inline void sleep(int value) { syscall(SYS_futex, reinterpret_cast<int*>(&signal), FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0); }
+    inline void wake() { syscall(SYS_futex, reinterpret_cast<int*>(&signal), FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0); }
+#else
+    inline void sleep(int) { std::this_thread::yield(); }
+    inline void wake() {}
+#endif
+};
+
+} // namespace aspino
+
+#endif
@@ -0,0 +1,45 @@
+input = """
+3 3 7 3 9 0 0
+1 2 3 2 10 3 6
+1 4 0 0 
+5 6 1 1 0 10 1
+1 9 3 0 9 8 4
+1 1 3 2 10 8 5
+1 2 3 0 7 3 5
+1 9 2 0 4 9
+5 10 3 1 1 10 3
+1 6 2 1 5 4
+1 8 3 0 2 8 5
+2 6 1 0 1 8
+1 7 0 0 
+1 10 2 0 6 4
+5 2 1 2 0 9 7 3 1
+1 8 3 0 6 2 5
+1 8 0 0 
+1 4 2 1 10 9
+1 9 3 1 2 9 6
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+7 a7
+8 a8
+9 a9
+10 a10
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a10, a2, a3, a4, a6, a7, a8}
+{a10, a2, a3, a4, a6, a7, a8, a9}
+{a10, a2, a4, a6, a7, a8}
+{a10, a2, a4, a6, a7, a8, a9}
+"""
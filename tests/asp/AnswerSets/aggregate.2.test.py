@@ -0,0 +1,42 @@
+input = """
+3 2 6 7 0 0
+1 5 2 0 3 7
+1 1 1 1 5
+1 3 1 1 7
+1 3 1 0 5
+1 5 2 1 5 7
+1 8 1 0 4
+1 2 1 0 6
+1 8 1 1 2
+2 5 3 2 2 2 3 5
+1 5 2 0 3 2
+1 7 0 0 
+1 8 2 0 6 2
+1 3 0 0 
+2 7 1 0 1 5
+5 3 2 3 1 4 6 2 1 1 1
+1 8 0 0 
+1 7 1 1 2
+2 8 3 2 1 4 7 3
+1 6 2 0 4 2
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+7 a7
+8 a8
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a2, a3, a5, a6, a7, a8}
+{a3, a5, a7, a8}
+"""
@@ -0,0 +1,38 @@
+input = """
+3 2 3 4 0 0
+2 3 2 0 2 6 3
+1 2 3 0 5 4 2
+1 4 0 0 
+2 8 3 1 3 5 2 7
+1 5 0 0 
+1 5 2 1 4 3
+1 7 3 0 2 8 5
+1 2 1 1 6
+1 1 3 2 6 5 8
+1 2 1 0 7
+1 1 2 0 6 5
+1 8 3 2 7 2 4
+1 5 3 1 7 5 8
+5 5 4 3 2 3 6 4 2 3 1
+2 8 2 1 2 6 5
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+7 a7
+8 a8
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a2, a3, a4, a5, a7, a8}
+{a2, a4, a5, a7, a8}
+"""
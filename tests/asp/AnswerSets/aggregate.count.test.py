@@ -0,0 +1,20 @@
+input = """
+2 3 2 2 1 4 5
+1 4 0 0 
+1 5 0 0 
+0
+3 a3
+4 a4
+5 a5
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a4, a5}
+"""
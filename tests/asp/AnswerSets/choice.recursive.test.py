@@ -0,0 +1,50 @@
+input = """
+1 9 5 2 4 7 10 8 6
+3 2 10 9 5 2 8 3 2 4 5
+1 4 1 1 9
+3 3 8 6 2 0 0 
+3 3 5 7 9 2 0 2 10
+1 4 2 0 2 10
+3 3 10 7 6 1 1 2
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+7 a7
+8 a8
+9 a9
+10 a10
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a10, a4}
+{a10, a4, a6}
+{a10, a4, a6, a7}
+{a10, a4, a6, a7, a8}
+{a10, a4, a6, a8}
+{a10, a4, a7}
+{a10, a4, a7, a8}
+{a10, a4, a8}
+{a10, a6, a8, a9}
+{a2, a4}
+{a2, a4, a6}
+{a2, a4, a6, a8}
+{a2, a4, a8}
+{a4}
+{a4, a6}
+{a4, a6, a7}
+{a4, a6, a7, a8}
+{a4, a6, a8}
+{a4, a7}
+{a4, a7, a8}
+{a4, a8}
+"""
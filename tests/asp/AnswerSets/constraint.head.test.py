@@ -0,0 +1,22 @@
+input = """
+3 2 3 4 0 0
+1 2 2 1 2 3
+1 2 1 0 4
+0
+2 a
+3 b
+4 c
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{}
+{a, b, c}
+{a, c}
+"""
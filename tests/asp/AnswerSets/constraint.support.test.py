@@ -0,0 +1,21 @@
+input = """
+1 2 2 0 6 4
+1 2 0 0
+1 8 2 1 4 2
+1 8 1 1 8
+0
+2 a2
+4 a4
+6 a6
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a2}
+"""
@@ -0,0 +1,60 @@
+input = """
+3 4 12 8 7 4 0 0
+1 12 1 1 7
+1 3 3 1 13 9 5
+1 2 2 1 8 9
+1 7 1 1 12
+1 9 1 1 11
+1 8 2 1 3 12
+1 7 3 1 11 4 6
+1 5 3 0 2 9 13
+1 3 0 0 
+1 8 1 1 7
+1 6 1 0 9
+1 4 3 2 2 11 6
+1 11 1 1 13
+1 8 2 2 9 13
+1 5 2 1 4 3
+1 13 1 0 9
+1 13 2 1 8 5
+1 2 0 0 
+1 5 0 0 
+1 12 3 1 4 13 5
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+7 a7
+8 a8
+9 a9
+11 a11
+12 a12
+13 a13
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+flags = "--asp-enumeration=assumptions"
+
+output = """
+{a11, a12, a2, a3, a4, a5, a7, a8}
+{a11, a12, a2, a3, a4, a5, a8}
+{a11, a12, a2, a3, a5, a7, a8}
+{a11, a12, a2, a3, a5, a8}
+{a11, a2, a3, a4, a5, a7, a8}
+{a11, a2, a3, a5, a7, a8}
+{a12, a13, a2, a3, a4, a5, a6, a7, a8, a9}
+{a12, a13, a2, a3, a4, a5, a6, a7, a9}
+{a12, a13, a2, a3, a5, a6, a7, a8, a9}
+{a12, a13, a2, a3, a5, a6, a7, a9}
+{a12, a13, a2, a3, a5, a6, a8, a9}
+{a13, a2, a3, a4, a5, a6, a7, a8, a9}
+{a13, a2, a3, a4, a5, a6, a7, a9}
+"""
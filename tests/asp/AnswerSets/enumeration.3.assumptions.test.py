@@ -0,0 +1,42 @@
+input = """
+3 3 10 5 3 0 0
+1 11 2 0 7 10
+1 7 0 0 
+1 6 0 0 
+1 10 1 0 11
+1 5 3 1 9 2 8
+1 7 0 0 
+1 9 2 1 3 7
+1 2 0 0 
+1 11 3 2 10 6 9
+0
+2 a2
+3 a3
+5 a5
+6 a6
+7 a7
+8 a8
+9 a9
+10 a10
+11 a11
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+flags = "--asp-enumeration=assumptions"
+
+output = """
+{a10, a11, a2, a3, a5, a6, a7}
+{a10, a11, a2, a3, a6, a7}
+{a10, a11, a2, a5, a6, a7, a9}
+{a10, a11, a2, a6, a7, a9}
+{a2, a3, a5, a6, a7}
+{a2, a3, a6, a7}
+{a2, a5, a6, a7, a9}
+{a2, a6, a7, a9}
+"""
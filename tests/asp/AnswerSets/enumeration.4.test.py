@@ -0,0 +1,52 @@
+input = """
+3 4 6 5 13 12 0 0
+1 3 1 1 2
+1 7 2 1 6 13
+1 11 1 0 9
+1 8 1 1 3
+1 4 2 2 13 8
+1 3 3 2 7 5 12
+1 4 0 0 
+1 10 1 0 6
+1 7 1 1 8
+1 7 0 0 
+1 2 2 0 9 6
+1 11 3 2 10 4 12
+1 11 2 1 3 5
+1 13 0 0 
+1 7 3 1 4 2 10
+1 4 1 0 8
+1 12 3 3 3 13 4
+1 9 3 1 6 3 2
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+7 a7
+8 a8
+9 a9
+10 a10
+11 a11
+12 a12
+13 a13
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a10, a12, a13, a3, a4, a5, a6, a7}
+{a10, a12, a13, a3, a4, a6, a7}
+{a10, a13, a3, a4, a5, a6, a7}
+{a10, a13, a3, a4, a6, a7}
+{a12, a13, a3, a4, a5, a7}
+{a12, a13, a3, a4, a7}
+{a13, a3, a4, a5, a7}
+{a13, a3, a4, a7}
+"""
@@ -0,0 +1,23 @@
+input = """
+3 2 2 3 0 0
+1 1 2 2 2 3
+1 4 1 0 2
+0
+2 a
+3 b
+4 c
+5 d
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a, b, c}
+{a, c}
+{b}
+"""
@@ -0,0 +1,33 @@
+input = """
+3 4 4 3 13 12 0 0
+1 7 2 1 5 3
+1 1 2 1 13 3
+1 9 1 0 12
+1 1 2 1 13 3
+1 9 0 0 
+1 5 1 0 7
+2 5 3 1 3 10 13 8
+1 9 3 2 10 3 7
+0
+2 a2
+3 a3
+10 a10
+12 a12
+13 a13
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+flags = "--asp-project"
+
+output = """
+{}
+{a12}
+{a12, a13}
+{a13}
+"""
@@ -0,0 +1,31 @@
+input = """
+3 3 5 10 11 0 0
+1 8 0 0 
+1 3 0 0 
+2 6 2 0 2 8 9
+1 5 1 1 11
+1 1 3 2 9 3 5
+1 11 3 1 2 7 5
+1 9 1 1 5
+0
+2 a2
+3 a3
+5 a5
+6 a6
+11 a11
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+flags = "--asp-project"
+
+output = """
+{a11, a3, a5}
+{a11, a3, a6}
+{a3, a5}
+"""
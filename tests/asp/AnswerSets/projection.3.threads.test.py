@@ -0,0 +1,34 @@
+input = """
+3 3 10 5 11 0 0
+1 11 3 1 11 10 9
+1 3 2 1 2 7
+1 12 2 1 6 8
+2 4 3 1 2 11 5 10
+1 1 3 2 12 8 2
+1 1 2 1 8 12
+1 12 3 0 10 12 3
+1 3 3 1 10 6 7
+1 1 2 0 12 10
+0
+2 a2
+5 a5
+6 a6
+9 a9
+11 a11
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+flags = "--asp-project --asp-threads=2"
+
+output = """
+{}
+{a11}
+{a11, a5}
+{a5}
+"""
@@ -0,0 +1,29 @@
+input = """
+3 3 7 10 5 0 0
+1 10 1 0 2
+1 11 2 1 7 9
+1 3 0 0 
+1 6 2 0 5 6
+0
+2 a2
+7 a7
+9 a9
+10 a10
+11 a11
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+flags = "--asp-project --asp-threads=2"
+
+output = """
+{}
+{a10}
+{a10, a7}
+{a7}
+"""
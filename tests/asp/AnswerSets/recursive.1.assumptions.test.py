@@ -0,0 +1,33 @@
+input = """
+3 2 9 5 0 0
+1 2 1 1 3
+1 3 0 0 
+1 2 3 2 7 4 8
+1 9 1 1 5
+1 2 2 0 6 4
+1 8 1 0 8
+1 5 0 0 
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+7 a7
+8 a8
+9 a9
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+flags = "--asp-enumeration=assumptions"
+
+output = """
+{a3, a5}
+{a3, a5, a9}
+"""
@@ -0,0 +1,46 @@
+input = """
+3 3 9 11 4 0 0
+1 10 3 0 10 5 8
+1 2 3 1 5 3 2
+1 7 2 0 2 7
+1 4 3 0 3 9 2
+1 10 3 1 3 9 7
+1 4 2 0 10 5
+1 5 3 2 4 7 9
+1 6 1 0 5
+1 5 3 2 7 5 11
+1 11 2 0 2 6
+1 8 1 0 8
+1 8 3 0 3 7 10
+1 10 1 1 5
+1 6 3 1 9 2 10
+1 8 1 0 7
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+7 a7
+8 a8
+9 a9
+10 a10
+11 a11
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+flags = "--asp-enumeration=assumptions"
+
+output = """
+{a10}
+{a10, a4}
+{a10, a4, a9}
+{a11, a5, a6, a9}
+{a5, a6, a9}
+"""
@@ -0,0 +1,46 @@
+input = """
+3 3 4 6 2 0 0
+1 10 3 2 9 4 3
+1 8 0 0 
+1 2 2 0 10 8
+1 9 0 0 
+1 2 3 1 3 2 10
+1 8 1 1 9
+1 9 3 2 10 9 7
+1 5 3 2 3 10 9
+1 2 3 0 10 7 3
+1 7 2 0 3 5
+1 8 0 0 
+1 3 3 2 10 3 7
+1 5 2 1 7 4
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+7 a7
+8 a8
+9 a9
+10 a10
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+flags = "--asp-enumeration=assumptions"
+
+output = """
+{a2, a4, a5, a6, a8, a9}
+{a2, a4, a5, a8, a9}
+{a2, a5, a6, a8, a9}
+{a2, a5, a8, a9}
+{a4, a5, a6, a8, a9}
+{a4, a5, a8, a9}
+{a5, a6, a8, a9}
+{a5, a8, a9}
+"""
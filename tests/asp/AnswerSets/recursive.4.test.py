@@ -0,0 +1,41 @@
+input = """
+3 2 4 5 0 0
+1 8 0 0 
+1 9 0 0 
+1 6 0 0 
+1 6 0 0 
+1 7 3 1 6 8 5
+1 5 3 2 4 3 8
+1 4 1 1 9
+1 5 3 1 7 6 3
+1 8 1 1 9
+1 9 3 1 9 2 8
+1 8 1 1 5
+1 9 2 1 7 2
+1 9 2 0 8 2
+1 3 0 0 
+1 8 0 0 
+1 8 3 2 4 6 2
+1 5 3 1 2 5 7
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+7 a7
+8 a8
+9 a9
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a3, a4, a5, a6, a8, a9}
+{a3, a5, a6, a8, a9}
+"""
@@ -0,0 +1,45 @@
+input = """
+3 3 2 8 10 0 0
+1 6 0 0 
+1 2 2 1 4 8
+1 7 1 1 4
+1 5 0 0 
+1 4 1 1 6
+1 4 3 3 7 9 4
+1 6 0 0 
+1 5 1 1 2
+1 3 1 0 5
+1 4 2 1 5 3
+1 8 1 0 6
+1 9 3 2 10 8 2
+1 10 1 1 7
+1 10 3 1 4 3 2
+1 2 2 0 9 10
+1 7 0 0 
+1 8 3 2 4 10 9
+1 4 3 0 6 8 10
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+7 a7
+8 a8
+9 a9
+10 a10
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+flags = "--asp-enumeration=assumptions"
+
+output = """
+{a10, a2, a3, a4, a5, a6, a7, a8}
+{a10, a3, a4, a5, a6, a7, a8}
+"""
@@ -0,0 +1,31 @@
+input = """
+3 2 2 4 0 0
+1 6 3 0 6 5 4
+1 6 2 1 4 6
+1 6 0 0 
+1 3 3 1 3 6 7
+1 5 2 1 2 3
+1 4 2 1 2 4
+1 6 0 0 
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+7 a7
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a2, a4, a6}
+{a2, a6}
+{a4, a6}
+{a6}
+"""
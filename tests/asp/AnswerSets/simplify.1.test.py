@@ -0,0 +1,40 @@
+input = """
+3 3 5 2 7 0 0
+1 4 2 1 2 6
+1 8 4 2 7 8 2 6
+1 4 1 0 3
+1 2 1 0 7
+1 2 2 1 2 6
+1 2 1 0 8
+1 2 3 2 3 8 6
+1 8 1 0 7
+1 2 2 1 4 7
+1 6 4 2 6 4 5 6
+1 6 4 2 6 4 5 6
+1 8 3 0 3 8 2
+1 6 1 0 6
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+7 a7
+8 a8
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{}
+{a2}
+{a2, a5}
+{a2, a5, a7, a8}
+{a2, a7, a8}
+{a5}
+"""
@@ -0,0 +1,37 @@
+input = """
+1 6 4 1 2 8 7 4
+3 2 2 5 0 0
+1 6 1 1 9
+1 8 1 0 5
+1 3 1 1 6
+1 10 5 2 2 7 8 3 6
+1 9 1 1 6
+1 4 1 1 9
+1 6 4 1 2 8 7 4
+1 9 1 0 6
+1 4 2 2 6 10
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+7 a7
+8 a8
+9 a9
+10 a10
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a2, a3, a4, a5, a8, a9}
+{a2, a3, a4, a9}
+{a3, a4, a5, a8, a9}
+{a3, a4, a9}
+"""
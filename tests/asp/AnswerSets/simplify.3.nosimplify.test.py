@@ -0,0 +1,38 @@
+input = """
+1 11 1 1 7
+1 5 1 0 9
+1 7 1 0 6
+1 5 2 0 8 11
+1 11 1 1 7
+3 2 9 5 0 0
+1 2 2 0 10 7
+1 3 4 1 3 4 9 8
+1 6 4 1 3 4 9 8
+1 3 2 0 6 10
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+7 a7
+8 a8
+9 a9
+10 a10
+11 a11
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+flags = "--no-asp-simplify"
+
+output = """
+{a11}
+{a11, a5}
+{a11, a5, a9}
+"""
@@ -0,0 +1,37 @@
+input = """
+1 7 2 2 5 3
+3 3 6 4 2 0 0
+1 4 1 0 5
+1 4 2 2 5 3
+1 4 4 1 3 7 2 3
+1 3 1 0 2
+1 6 2 1 5 3
+1 7 2 0 2 5
+1 4 2 2 5 3
+1 4 2 1 3 5
+1 7 2 0 2 5
+1 5 4 2 7 5 5 7
+1 4 1 0 4
+1 4 2 1 5 3
+1 2 4 2 7 5 5 7
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+7 a7
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a2, a3, a4, a6}
+{a4, a6, a7}
+{a4, a7}
+"""
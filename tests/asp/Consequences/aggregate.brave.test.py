@@ -0,0 +1,30 @@
+input = """
+3 2 2 3 0 0
+2 1 2 0 2 2 3
+5 4 10 2 0 2 3 10 10
+2 5 2 1 1 6 2
+2 7 1 0 1 8
+1 8 1 0 7
+1 8 1 0 3
+0
+2 a
+3 b
+4 d
+5 e
+6 f
+7 g
+8 h
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+flags = "--asp-reasoning=brave"
+
+output = """
+{a, b, d, e, g, h}
+"""
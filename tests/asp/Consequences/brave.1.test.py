@@ -0,0 +1,35 @@
+input = """
+3 3 4 9 8 0 0
+1 8 2 0 4 7
+1 10 2 0 3 11
+1 4 1 0 11
+1 3 2 0 9 8
+1 10 3 0 2 5 7
+1 7 3 1 8 4 5
+1 5 2 1 11 9
+1 11 1 0 10
+1 5 2 0 7 11
+0
+2 a2
+3 a3
+4 a4
+5 a5
+7 a7
+8 a8
+9 a9
+10 a10
+11 a11
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+flags = "--asp-reasoning=brave"
+
+output = """
+{a3, a4, a5, a8, a9}
+"""
@@ -0,0 +1,27 @@
+input = """
+3 3 4 3 2 4 2 8 6 7 5
+3 3 5 3 2 1 0 4
+3 2 2 4 1 0 2
+1 5 2 2 2 4
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+7 a7
+8 a8
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+flags = "--asp-reasoning=brave"
+
+output = """
+{a5}
+"""
@@ -0,0 +1,20 @@
+input = """
+3 1 3 0 0
+1 2 1 1 2
+0
+2 a
+3 b
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+flags = "--asp-reasoning=cautious"
+
+output = """
+UNSATISFIABLE
+"""
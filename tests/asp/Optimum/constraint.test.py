@@ -0,0 +1,23 @@
+input = """
+3 3 2 3 4 0 0
+1 1 2 2 2 3
+1 5 1 0 4
+6 0 3 0 2 3 5 3 1 1
+0
+2 a
+3 b
+4 c
+5 d
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{b}
+Optimization: 1
+"""
@@ -0,0 +1,73 @@
+input = """
+3 6 3 16 12 10 15 11 0 0
+1 2 0 0 
+1 14 2 0 6 15
+1 18 0 0 
+1 5 0 0 
+1 10 2 0 18 17
+1 6 1 1 3
+1 6 3 2 5 4 8
+1 18 0 0 
+1 7 1 1 14
+1 9 1 0 7
+1 8 0 0 
+1 2 0 0 
+1 9 1 1 19
+1 12 3 1 15 14 18
+1 19 1 0 10
+1 11 1 0 10
+1 18 0 0 
+1 5 2 0 6 14
+1 11 2 0 14 10
+1 8 3 2 6 12 4
+1 19 2 2 17 11
+1 13 2 0 6 14
+1 3 1 1 11
+1 17 3 3 4 7 13
+1 13 0 0 
+1 12 2 0 17 10
+1 7 3 0 15 9 11
+1 12 0 0 
+1 11 2 1 7 10
+1 9 3 3 12 4 7
+1 7 3 2 14 11 12
+1 3 2 1 15 18
+1 6 1 0 17
+1 4 0 0 
+1 14 1 1 18
+1 19 1 1 15
+1 9 3 1 4 8 19
+6 0 3 1 17 8 4 1 4 2
+6 0 1 0 11 1
+6 0 2 1 2 13 3 4
+0
+2 a2
+3 a3
+4 a4
+7 a7
+8 a8
+9 a9
+11 a11
+12 a12
+13 a13
+15 a15
+16 a16
+17 a17
+18 a18
+19 a19
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a12, a13, a15, a16, a18, a19, a2, a3, a4, a7, a8, a9}
+{a12, a13, a15, a18, a19, a2, a3, a4, a7, a8, a9}
+{a12, a13, a16, a18, a19, a2, a3, a4, a7, a8, a9}
+{a12, a13, a18, a19, a2, a3, a4, a7, a8, a9}
+Optimization: 4 0 7
+"""
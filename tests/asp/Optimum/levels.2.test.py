@@ -0,0 +1,36 @@
+input = """
+3 2 9 7 0 0
+1 4 3 1 6 7 9
+1 6 0 0 
+1 4 0 0 
+1 6 1 0 3
+1 8 1 1 6
+1 7 0 0 
+1 6 1 0 3
+1 6 2 0 5 9
+1 3 1 0 4
+1 2 0 0 
+6 0 2 0 8 5 1 2
+6 0 4 0 2 3 9 4 3 2 1 2
+6 0 2 1 9 6 4 4
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+8 a8
+9 a9
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a2, a3, a4, a6, a9}
+Optimization: 4 8 0
+"""
@@ -0,0 +1,44 @@
+input = """
+3 2 4 8 0 0
+1 2 0 0 
+1 4 0 0 
+1 3 1 0 7
+1 7 0 0 
+1 6 0 0 
+1 6 2 0 5 4
+1 3 0 0 
+1 7 2 0 6 5
+1 7 0 0 
+1 2 1 1 5
+1 9 3 1 5 8 6
+1 8 2 1 3 2
+1 7 3 1 8 2 5
+1 5 2 1 6 4
+1 7 3 1 2 8 4
+1 9 1 0 8
+1 5 0 0 
+1 7 1 0 3
+6 0 4 2 6 5 2 8 3 2 4 4
+6 0 2 1 5 3 2 5
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+7 a7
+8 a8
+9 a9
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a2, a3, a4, a5, a6, a7}
+Optimization: 5 4
+"""
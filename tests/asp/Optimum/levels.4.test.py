@@ -0,0 +1,41 @@
+input = """
+3 3 2 10 9 0 0
+1 2 0 0 
+1 10 0 0 
+1 11 3 2 3 4 8
+1 11 1 0 5
+1 8 2 2 7 2
+1 3 2 1 9 11
+1 10 0 0 
+1 2 0 0 
+1 7 2 1 9 11
+1 6 1 0 4
+1 2 3 2 11 10 8
+1 5 1 0 11
+1 7 0 0 
+1 3 0 0 
+6 0 3 1 3 11 6 4 2 4
+6 0 3 0 9 11 10 4 4 2
+6 0 2 0 7 6 1 4
+0
+3 a3
+4 a4
+6 a6
+7 a7
+8 a8
+9 a9
+10 a10
+11 a11
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a10, a3, a7}
+Optimization: 1 2 0
+"""
@@ -0,0 +1,27 @@
+input = """
+3 8 2 3 4 5 6 7 8 9 0 0
+2 1 6 3 3 2 6 3 7 4 5
+6 0 7 2 2 7 8 4 3 6 5 2 3 2 3 3 1 3
+6 0 8 6 6 5 4 7 8 2 9 3 1 2 3 1 1 3 1 1
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+7 a7
+8 a8
+9 a9
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a2, a3, a4, a5, a6, a8}
+Optimization: 2 15
+"""
@@ -0,0 +1,28 @@
+input = """
+3 4 2 3 4 5 0 0
+2 1 4 0 3 2 3 4 5
+6 0 4 0 2 3 4 5 1 1 1 1
+6 0 4 4 2 3 4 5 1 1 1 1
+0
+2 a
+3 b
+4 c
+5 d
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a, b}
+{a, c}
+{a, d}
+{b, c}
+{b, d}
+{c, d}
+Optimization: 2 2
+"""
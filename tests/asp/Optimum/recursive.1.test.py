@@ -0,0 +1,32 @@
+input = """
+3 3 9 5 7 0 0
+1 5 3 1 10 2 3
+1 3 2 1 5 6
+1 8 1 0 2
+1 6 2 0 5 3
+1 10 0 0 
+1 9 0 0 
+1 11 2 1 3 6
+1 5 2 0 4 2
+1 11 1 1 6
+6 0 3 1 6 10 8 2 4 5
+6 0 2 0 6 8 4 5
+0
+2 a2
+6 a6
+8 a8
+10 a10
+11 a11
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a10, a11}
+Optimization: 0 6
+"""
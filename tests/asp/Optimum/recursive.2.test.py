@@ -0,0 +1,42 @@
+input = """
+3 4 2 12 3 6 0 0
+1 3 1 0 2
+1 4 1 0 13
+1 6 1 1 8
+1 3 2 1 7 4
+1 5 2 0 8 3
+1 7 1 0 13
+1 7 0 0 
+1 7 0 0 
+1 9 1 1 7
+1 11 2 1 10 4
+1 13 3 0 2 4 11
+1 3 1 0 6
+1 12 3 3 11 5 7
+1 2 2 0 7 9
+6 0 3 2 6 9 4 3 5 1
+6 0 3 1 11 9 10 1 2 2
+0
+2 a2
+4 a4
+6 a6
+7 a7
+8 a8
+9 a9
+10 a10
+11 a11
+13 a13
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a2, a6, a7}
+{a6, a7}
+Optimization: 1 5
+"""
@@ -0,0 +1,36 @@
+input = """
+3 3 10 9 3 0 0
+1 4 3 1 12 7 10
+1 8 1 1 11
+1 7 2 1 12 4
+1 6 1 0 2
+1 2 1 0 11
+1 5 2 1 8 3
+1 9 3 2 4 2 6
+1 3 0 0 
+6 0 2 1 8 2 5 3
+6 0 3 1 6 11 3 3 4 5
+0
+2 a2
+3 a3
+4 a4
+5 a5
+6 a6
+8 a8
+10 a10
+11 a11
+12 a12
+0
+B+
+0
+B-
+1
+0
+1
+"""
+
+output = """
+{a10, a3, a8}
+{a3, a8}
+Optimization: 8 0
+"""
@@ -0,0 +1,34 @@
+def decodeAnswerSet(string):
+    return "{" + ", ".join(sorted(string.replace("{", " ").replace("}", " ").replace(",", " ").split())) + "}"
+
+def decodeAnswerSets(string):
+    answerSets = []
+    lines = string.split("\n")
+    for i in range(len(lines)):
+        if lines[i].startswith("Answer:"):
+            answerSets.append(decodeAnswerSet(lines[i+1] if i+1 < len(lines) else ""))
+    return answerSets
+
+def checker(actualOutput, actualError):
+    global output
+
+    if actualError:
+        reportFailure(output, actualError)
+        return
+
+    if not actualOutput:
+        reportFailure(output, "No output stream!")
+        return
+
+    # estimates are printed while they are refined: the last one is the answer
+    expected = output.strip()
+    actual = decodeAnswerSets(actualOutput)
+    if expected == "UNSATISFIABLE":
+        if len(actual) > 0 or "UNSATISFIABLE" not in actualOutput:
+            reportFailure(expected, actual)
+        else:
+            reportSuccess(expected, expected)
+    elif len(actual) == 0 or actual[-1] != decodeAnswerSet(expected):
+        reportFailure(decodeAnswerSet(expected), actual)
+    else:
+        reportSuccess(expected, actual[-1])
@@ -0,0 +1,37 @@
+def decodeAnswerSet(string):
+    return "{" + ", ".join(sorted(string.replace("{", " ").replace("}", " ").replace(",", " ").split())) + "}"
+
+def decodeAnswerSets(string):
+    answerSets = []
+    lines = string.split("\n")
+    for i in range(len(lines)):
+        if lines[i].startswith("Answer:"):
+            answerSets.append(decodeAnswerSet(lines[i+1] if i+1 < len(lines) else ""))
+    return answerSets
+
+def decodeExpected(string):
+    return [decodeAnswerSet(line) for line in string.strip().split("\n") if line.strip().startswith("{")]
+
+def checker(actualOutput, actualError):
+    global output
+
+    if actualError:
+        reportFailure(output, actualError)
+        return
+
+    if not actualOutput:
+        reportFailure(output, "No output stream!")
+        return
+
+    # answer sets are compared as multisets: an answer set printed twice is a failure
+    expected = sorted(decodeExpected(output))
+    actual = sorted(decodeAnswerSets(actualOutput))
+    if len(expected) == 0:
+        if len(actual) > 0 or "UNSATISFIABLE" not in actualOutput:
+            reportFailure("UNSATISFIABLE", actual)
+        else:
+            reportSuccess("UNSATISFIABLE", "UNSATISFIABLE")
+    elif expected != actual:
+        reportFailure(expected, actual)
+    else:
+        reportSuccess(expected, actual)
@@ -0,0 +1,44 @@
+def decodeAnswerSet(string):
+    return "{" + ", ".join(sorted(string.replace("{", " ").replace("}", " ").replace(",", " ").split())) + "}"
+
+def decodeAnswerSets(string):
+    answerSets = []
+    lines = string.split("\n")
+    for i in range(len(lines)):
+        if lines[i].startswith("Answer:"):
+            answerSets.append(decodeAnswerSet(lines[i+1] if i+1 < len(lines) else ""))
+    return answerSets
+
+def decodeOptimization(string):
+    return [line.split()[1:] for line in string.split("\n") if line.startswith("Optimization:")]
+
+def checker(actualOutput, actualError):
+    global output
+
+    if actualError:
+        reportFailure(output, actualError)
+        return
+
+    if not actualOutput:
+        reportFailure(output, "No output stream!")
+        return
+
+    # the expected output lists all optimal answer sets: the printed one must be among them, with the optimum of each level
+    expected = [decodeAnswerSet(line) for line in output.strip().split("\n") if line.strip().startswith("{")]
+    expectedOptimization = decodeOptimization(output)
+    actual = decodeAnswerSets(actualOutput)
+    actualOptimization = decodeOptimization(actualOutput)
+    bounds = [line for line in actualOutput.split("\n") if line.startswith("o ") or line.startswith("c ")]
+    if len(bounds) > 0:
+        reportFailure(output, bounds)
+    elif len(expected) == 0:
+        if len(actual) > 0 or "UNSATISFIABLE" not in actualOutput:
+            reportFailure("UNSATISFIABLE", actual)
+        else:
+            reportSuccess("UNSATISFIABLE", "UNSATISFIABLE")
+    elif len(actual) != 1 or actual[0] not in expected:
+        reportFailure(expected, actual)
+    elif actualOptimization != expectedOptimization or "OPTIMUM FOUND" not in actualOutput:
+        reportFailure(expectedOptimization, actualOptimization)
+    else:
+        reportSuccess(expectedOptimization, actualOptimization)
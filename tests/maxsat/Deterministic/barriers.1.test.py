@@ -0,0 +1,435 @@
+input = """
+p wcnf 95 425 1000
+1000 -17 48 78 0
+1000 61 34 -71 0
+1000 -70 71 61 0
+1000 -82 20 67 0
+1000 -21 76 -6 0
+1000 -61 -77 -93 0
+1000 94 -74 57 0
+1000 5 -18 -64 0
+1000 -81 -39 -54 0
+1000 75 -30 44 0
+1000 90 42 -70 0
+1000 -37 -16 9 0
+1000 45 9 -53 0
+1000 55 54 -16 0
+1000 -92 76 43 0
+1000 40 1 10 0
+1000 -53 38 79 0
+1000 44 -41 -47 0
+1000 59 -67 -50 0
+1000 82 -93 -92 0
+1000 -34 67 -39 0
+1000 -75 41 3 0
+1000 -82 -81 -43 0
+1000 -78 91 36 0
+1000 -87 -3 -48 0
+1000 76 -77 41 0
+1000 -41 -48 -77 0
+1000 14 -4 73 0
+1000 -84 35 -31 0
+1000 84 -90 -13 0
+1000 87 29 -57 0
+1000 -95 -84 28 0
+1000 16 -5 68 0
+1000 36 -44 83 0
+1000 -54 -38 -67 0
+1000 -82 -54 38 0
+1000 53 -20 -26 0
+1000 72 -92 -29 0
+1000 70 -44 30 0
+1000 32 -6 5 0
+1000 2 -62 16 0
+1000 -85 3 68 0
+1000 -44 17 -33 0
+1000 29 26 16 0
+1000 -36 -17 1 0
+1000 -35 32 -80 0
+1000 42 1 8 0
+1000 7 9 -62 0
+1000 -41 -21 -10 0
+1000 -76 39 -47 0
+1000 55 -16 17 0
+1000 -73 -23 -6 0
+1000 -82 6 -80 0
+1000 -81 -64 -90 0
+1000 59 -3 32 0
+1000 55 -29 -17 0
+1000 -72 34 -16 0
+1000 -86 14 94 0
+1000 -61 19 31 0
+1000 -73 13 85 0
+1000 44 -16 -4 0
+1000 75 39 12 0
+1000 -71 13 8 0
+1000 31 -24 -83 0
+1000 -33 -48 -77 0
+1000 11 -49 65 0
+1000 -54 89 -73 0
+1000 -20 -21 -13 0
+1000 76 -93 24 0
+1000 -19 75 -66 0
+1000 -86 91 -53 0
+1000 -3 35 62 0
+1000 -73 -47 31 0
+1000 54 -90 62 0
+1000 -62 93 -10 0
+1000 30 31 -83 0
+1000 31 25 34 0
+1000 -33 22 -6 0
+1000 12 94 -11 0
+1000 -38 -5 46 0
+1000 -4 -43 56 0
+1000 -27 -83 75 0
+1000 -70 41 -16 0
+1000 -15 57 -68 0
+1000 -87 -48 58 0
+1000 44 -87 -73 0
+1000 8 92 38 0
+1000 48 84 59 0
+1000 -43 -83 93 0
+1000 59 62 40 0
+1000 -92 -24 71 0
+1000 35 50 -7 0
+1000 -65 -35 -32 0
+1000 -58 -70 9 0
+1000 20 35 76 0
+1000 -24 -90 25 0
+1000 -76 78 19 0
+1000 -73 -23 -26 0
+1000 -4 -57 -53 0
+1000 -82 -64 68 0
+1000 77 25 94 0
+1000 -63 23 68 0
+1000 -68 28 -5 0
+1000 -85 20 18 0
+1000 4 47 -80 0
+1000 -69 -3 -44 0
+1000 89 18 -11 0
+1000 -27 9 -26 0
+1000 -41 14 6 0
+1000 -91 -21 51 0
+1000 -69 -55 27 0
+1000 -60 -59 89 0
+1000 -59 -5 -93 0
+1000 -58 68 47 0
+1000 27 -34 48 0
+1000 21 -27 3 0
+1000 82 4 -18 0
+1000 63 -24 -8 0
+1000 41 53 -5 0
+1000 6 51 64 0
+1000 13 50 -61 0
+1000 80 15 -45 0
+1000 -36 60 -39 0
+1000 -4 -44 81 0
+1000 8 88 56 0
+1000 4 88 12 0
+1000 -62 7 -25 0
+1000 44 -62 -45 0
+1000 78 -81 51 0
+1000 -53 -15 -65 0
+1000 -23 -95 94 0
+1000 47 -54 -57 0
+1000 -45 -35 22 0
+1000 20 -22 91 0
+1000 89 -87 85 0
+1000 77 -83 -8 0
+1000 -94 83 43 0
+1000 -25 -52 14 0
+1000 58 11 84 0
+1000 20 83 19 0
+1000 -37 -27 29 0
+1000 60 23 80 0
+1000 77 -4 13 0
+1000 14 60 -52 0
+1000 -86 -90 45 0
+1000 -38 77 57 0
+1000 -70 1 -60 0
+1000 45 -25 -63 0
+1000 83 9 -78 0
+1000 -8 -43 31 0
+1000 33 28 42 0
+1000 -95 -79 60 0
+1000 -80 -53 62 0
+1000 38 3 24 0
+1000 38 -65 67 0
+1000 -25 -27 36 0
+1000 45 -60 95 0
+1000 -14 -57 39 0
+1000 -27 -20 -63 0
+1000 -21 -56 40 0
+1000 -47 -37 -4 0
+1000 39 32 67 0
+1000 81 68 20 0
+1000 -1 -27 60 0
+1000 63 -24 -31 0
+1000 44 -7 -78 0
+1000 -34 -32 -87 0
+1000 -44 6 4 0
+1000 -73 -32 18 0
+1000 36 3 -22 0
+1000 -83 -8 -59 0
+1000 -67 81 22 0
+1000 88 -18 -71 0
+1000 -57 -59 -36 0
+1000 -68 20 74 0
+1000 -53 -63 30 0
+1000 41 -74 77 0
+1000 36 -91 35 0
+1000 -48 -5 66 0
+1000 -40 -45 -24 0
+1000 7 -35 -28 0
+1000 -79 51 72 0
+1000 54 -33 53 0
+1000 26 95 11 0
+1000 -37 -89 -9 0
+1000 60 35 38 0
+1000 63 22 -19 0
+1000 87 51 -83 0
+1000 7 -24 81 0
+1000 84 17 19 0
+1000 -49 14 56 0
+1000 36 14 -17 0
+1000 17 50 46 0
+1000 48 19 -62 0
+1000 -70 -63 14 0
+1000 -95 -45 -68 0
+1000 69 -40 -57 0
+1000 26 -77 38 0
+1000 41 35 26 0
+1000 53 79 23 0
+1000 -16 -52 73 0
+1000 -60 -70 75 0
+1000 -76 -77 -28 0
+1000 -82 -41 -76 0
+1000 37 39 35 0
+1000 94 -44 -83 0
+1000 -35 -58 17 0
+1000 -80 68 67 0
+1000 -54 55 71 0
+1000 49 -50 28 0
+1000 8 -71 -64 0
+1000 92 -72 -47 0
+1000 -65 -48 52 0
+1000 -75 64 19 0
+1000 48 9 79 0
+1000 -27 42 56 0
+1000 -4 -69 -94 0
+1000 -93 28 -57 0
+1000 -29 -61 18 0
+1000 16 -23 77 0
+1000 -45 49 -1 0
+1000 36 -18 -50 0
+1000 56 37 -13 0
+1000 -42 -9 -2 0
+1000 -81 -13 85 0
+1000 -42 26 83 0
+1000 83 67 4 0
+1000 -30 -61 -69 0
+1000 59 85 -68 0
+1000 -44 -76 -18 0
+1000 75 -93 95 0
+1000 93 -56 40 0
+1000 24 -14 59 0
+1000 -41 -24 5 0
+1000 50 88 -94 0
+1000 47 -50 -29 0
+1000 -45 34 7 0
+1000 29 39 57 0
+1000 62 -90 27 0
+1000 -23 -88 68 0
+1000 -81 39 57 0
+1000 69 59 -63 0
+1000 -67 54 -88 0
+1000 -65 -63 45 0
+1000 -15 92 -54 0
+1000 14 -45 -68 0
+1000 -81 -70 -20 0
+1000 6 75 -45 0
+1000 -75 -87 -37 0
+1000 -2 -55 -87 0
+1000 48 -73 24 0
+1000 73 -50 92 0
+1000 41 -93 -63 0
+1000 -26 53 71 0
+1000 78 62 90 0
+1000 16 -13 -71 0
+1000 -51 -36 -9 0
+1000 30 34 -16 0
+1000 -48 -56 19 0
+1000 34 74 66 0
+1000 -34 45 94 0
+1000 91 -18 -11 0
+1000 15 42 -19 0
+1000 -35 -66 -18 0
+1000 -65 -73 -88 0
+1000 -38 70 35 0
+1000 5 22 56 0
+1000 -65 -94 27 0
+1000 -81 72 73 0
+1000 21 -28 -95 0
+1000 95 -37 20 0
+1000 34 18 12 0
+1000 -1 -90 -11 0
+1000 34 23 -90 0
+1000 88 90 54 0
+1000 -44 -67 93 0
+1000 6 -28 -50 0
+1000 -81 29 57 0
+1000 45 -28 -30 0
+1000 13 51 -41 0
+1000 13 -4 52 0
+1000 -26 -59 73 0
+1000 -67 76 55 0
+1000 58 -65 68 0
+1000 -57 67 17 0
+1000 47 68 -38 0
+1000 -9 62 32 0
+1000 3 61 -80 0
+1000 -2 -7 -45 0
+1000 63 -39 40 0
+1000 52 84 6 0
+1000 11 21 51 0
+1000 87 -39 66 0
+1000 47 -87 -64 0
+1000 -72 -51 56 0
+1000 -42 -40 -62 0
+1000 -27 -46 -13 0
+1000 -62 26 93 0
+1000 -75 7 -79 0
+1000 24 -41 -13 0
+1000 -56 -54 -73 0
+1000 -6 -47 -94 0
+1000 35 68 29 0
+1000 -78 4 -83 0
+1000 -62 49 -65 0
+1000 51 8 83 0
+1000 73 88 -92 0
+1000 66 15 -16 0
+1000 -71 17 55 0
+1000 -28 -89 -81 0
+1000 81 -57 66 0
+1000 -76 44 41 0
+1000 37 -26 11 0
+1000 29 -43 -30 0
+1000 -28 70 -27 0
+1000 31 -19 -36 0
+1000 -27 38 20 0
+1000 -81 -72 -15 0
+1000 -8 -69 51 0
+1000 -58 27 40 0
+1000 -54 52 -92 0
+1000 16 78 74 0
+1000 41 45 -77 0
+1000 7 -15 -41 0
+1000 -72 -38 -3 0
+1000 22 62 -1 0
+1000 62 -36 -49 0
+1000 -61 47 -90 0
+1000 -62 73 -64 0
+1000 10 92 40 0
+3 -95 0
+6 47 0
+4 2 -79 0
+3 -83 0
+6 -2 59 0
+2 86 0
+4 36 0
+6 27 0
+8 16 0
+6 -80 39 0
+4 -28 0
+3 -57 -67 0
+3 81 37 0
+3 57 -50 0
+5 -45 -22 0
+2 -50 0
+8 66 56 0
+6 -77 0
+8 -84 0
+9 -80 64 0
+5 89 0
+8 51 92 0
+5 -72 0
+1 26 0
+8 -38 0
+4 -1 0
+8 63 -77 0
+5 -81 0
+8 -67 61 0
+2 71 0
+6 45 0
+3 61 0
+6 -22 0
+4 91 66 0
+9 -87 0
+3 -72 -32 0
+7 -59 0
+7 -60 0
+1 -35 0
+5 16 2 0
+7 -51 0
+4 56 0
+5 -24 -55 0
+1 -90 0
+9 -50 0
+6 79 -21 0
+1 84 0
+8 -25 -18 0
+3 -33 49 0
+4 84 -14 0
+6 -39 -90 0
+3 -67 -10 0
+5 -25 0
+4 67 0
+6 58 32 0
+9 -85 0
+1 -40 80 0
+9 33 0
+8 34 68 0
+8 -25 0
+1 -8 -72 0
+2 -41 -53 0
+7 60 0
+2 57 -94 0
+9 -31 0
+5 -75 0
+7 10 0
+3 80 0
+2 46 0
+9 -22 0
+9 -3 14 0
+7 29 14 0
+2 87 -26 0
+3 -89 0
+2 65 85 0
+4 -83 0
+5 87 -8 0
+6 82 0
+3 58 0
+4 23 0
+9 -90 28 0
+5 57 0
+9 -31 16 0
+4 -13 -17 0
+1 -15 31 0
+2 61 0
+3 -42 0
+8 38 -10 0
+1 -46 0
+1 -23 0
+2 -37 0
+1 92 -50 0
+6 -71 0
+4 -42 0
+9 -20 50 0
+"""
+
+# with few conflicts per round, tasks are paused and resumed at many barriers
+flags = "--barrier-conflicts=20"
+
+output = """
+o 116
+"""
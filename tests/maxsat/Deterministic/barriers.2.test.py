@@ -0,0 +1,67 @@
+input = """
+p wcnf 18 60 164
+164 5 -3 -9 0
+164 16 -13 7 0
+164 -13 -14 1 0
+164 4 11 1 0
+164 13 7 -14 0
+164 16 8 -12 0
+164 10 1 -14 0
+164 4 -11 -14 0
+164 16 -17 13 0
+164 -13 -14 6 0
+164 15 -17 -4 0
+164 16 -1 -18 0
+164 6 18 8 0
+164 -13 -17 -12 0
+164 18 1 -13 0
+164 2 -16 -12 0
+164 12 -14 -18 0
+164 1 8 -6 0
+164 2 -3 17 0
+164 9 8 -18 0
+164 10 -3 6 0
+164 -9 -10 -15 0
+164 -4 -1 -10 0
+164 -7 9 -4 0
+164 -1 8 18 0
+164 6 -15 14 0
+164 -17 -1 13 0
+164 10 -5 7 0
+164 3 -10 -17 0
+164 5 -1 2 0
+9 13 0
+6 -7 0
+4 -4 0
+5 -16 -1 0
+5 6 0
+6 -5 11 0
+5 -4 -13 0
+9 3 0
+2 6 0
+9 -9 0
+9 -12 0
+6 10 0
+8 18 0
+6 14 0
+7 -5 0
+2 13 3 0
+5 10 0
+8 4 0
+5 1 0
+7 2 0
+4 14 -6 0
+3 8 -6 0
+7 -10 -9 0
+2 11 0
+1 -10 0
+8 -11 0
+2 -11 0
+2 -7 0
+6 6 0
+5 -8 0
+"""
+
+output = """
+o 29
+"""
@@ -0,0 +1,14 @@
+input = """
+c soft clauses added between calls; variable 6 is new for the assumptions of the first call
+s 2 -5 0
+s 3 6 2 0
+s 1 5 0
+a -6 -3 0
+s 2 -3 0
+a 0
+"""
+
+output = """
+o 1
+o 1
+"""
@@ -0,0 +1,37 @@
+input = """
+c weighted soft clauses added, removed and solved under assumptions
+h 1 2 3 0
+h -1 -2 0
+s 4 1 0
+s 3 2 0
+s 2 3 0
+a 0
+s 5 -3 0
+s 1 -1 -3 0
+a 0
+r 3
+a 0
+h -2 4 0
+s 6 -4 0
+a 0
+a 2 0
+r 6
+a 2 0
+a 1 2 0
+s 2 5 0
+s 2 -5 1 0
+a -1 0
+"""
+
+flags = "--maxsat-disjcores=wce"
+
+output = """
+o 3
+o 5
+o 3
+o 3
+o 10
+o 4
+UNSATISFIABLE
+o 6
+"""
@@ -0,0 +1,32 @@
+input = """
+c unweighted soft clauses over a growing set of variables
+s 1 1 0
+s 1 -1 2 0
+s 1 -2 0
+a 0
+s 1 3 0
+s 1 -3 -1 0
+s 1 4 -2 0
+a 0
+h -4 0
+s 1 -3 0
+a 0
+r 1
+r 6
+a 0
+s 1 5 6 0
+s 1 -5 0
+s 1 -6 0
+s 1 1 2 0
+a 3 0
+a -5 -6 0
+"""
+
+output = """
+o 1
+o 1
+o 2
+o 1
+o 3
+o 3
+"""
@@ -0,0 +1,15 @@
+input = """
+p wcnf 3 6 100
+100 -1 -2 0
+100 -2 -3 0
+l 2
+1 1 0
+1 2 0
+l 1
+5 3 0
+1 -1 0
+"""
+
+output = """
+o 1 1
+"""
@@ -0,0 +1,16 @@
+input = """
+p wcnf 3 5 100
+l 8
+100 -1 -2 0
+l 5
+1 -3 0
+l 3
+2 1 0
+3 2 0
+4 3 0
+l 0
+"""
+
+output = """
+o 0 6
+"""
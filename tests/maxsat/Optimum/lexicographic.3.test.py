@@ -0,0 +1,19 @@
+input = """
+p wcnf 6 8 24
+l 7
+2 -1 0
+l 6
+2 4 -6 0
+24 2 3 0
+l 7
+1 1 0
+l 9
+6 2 0
+6 1 0
+6 -4 0
+24 -2 -1 0
+"""
+
+output = """
+o 6 1 0
+"""
@@ -0,0 +1,25 @@
+input = """
+p wcnf 6 11 35
+l 9
+5 4 3 2 0
+35 -5 0
+l 4
+4 1 0
+l 9
+5 -3 2 0
+35 -2 -3 5 0
+35 5 -4 -4 0
+l 4
+4 -6 0
+35 -3 3 0
+l 9
+5 -4 3 -2 0
+l 4
+5 -1 0
+l 9
+6 4 3 0
+"""
+
+output = """
+o 5 4
+"""
@@ -0,0 +1,30 @@
+input = """
+p wcnf 11 18 33
+l 5
+6 -9 0
+3 -4 6 10 0
+33 9 -3 0
+33 9 0
+l 7
+3 -2 0
+6 9 0
+33 -7 -4 0
+33 7 -11 11 0
+33 -10 5 -5 0
+l -1
+1 5 5 11 0
+33 2 0
+4 11 9 0
+33 -1 -3 11 0
+33 -10 -5 -7 0
+3 -11 0
+l 5
+3 5 6 9 0
+33 -2 1 0
+l 7
+3 7 0
+"""
+
+output = """
+o 3 6 0
+"""
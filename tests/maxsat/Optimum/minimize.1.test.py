@@ -0,0 +1,139 @@
+input = """
+p wcnf 23 130 217
+217 -21 -17 -8 0
+217 -3 -22 -15 0
+217 13 -4 -9 0
+217 9 12 -21 0
+217 6 1 -21 0
+217 1 -3 -9 0
+217 19 15 -20 0
+217 6 -4 -16 0
+217 -20 -7 16 0
+217 -4 3 9 0
+217 6 -14 -4 0
+217 -22 -6 -18 0
+217 -16 15 -14 0
+217 -16 -13 8 0
+217 -19 -5 16 0
+217 23 -13 -14 0
+217 -16 9 12 0
+217 -21 18 -16 0
+217 -4 2 7 0
+217 -19 -17 10 0
+217 2 5 -7 0
+217 17 9 -6 0
+217 10 12 -2 0
+217 -16 -13 -8 0
+217 -20 -2 -8 0
+217 3 9 4 0
+217 -23 -5 -7 0
+217 5 18 -13 0
+217 -23 -12 18 0
+217 15 8 3 0
+217 -1 22 -8 0
+217 -15 9 -16 0
+217 2 22 -21 0
+217 4 2 21 0
+217 22 -10 2 0
+217 1 -15 16 0
+217 9 8 10 0
+217 -12 -4 -13 0
+217 -12 11 -1 0
+217 19 -23 10 0
+217 -21 -3 -15 0
+217 9 22 -14 0
+217 -23 16 8 0
+217 8 7 9 0
+217 15 22 18 0
+217 -22 -20 -21 0
+217 8 3 -21 0
+217 -15 23 -7 0
+217 -16 -7 -22 0
+217 18 -10 2 0
+217 9 16 10 0
+217 -17 -1 -22 0
+217 21 10 12 0
+217 7 17 -3 0
+217 -13 19 -16 0
+217 -8 -18 -21 0
+217 -4 -1 2 0
+217 10 -7 -4 0
+217 -20 15 -4 0
+217 20 3 23 0
+217 18 19 13 0
+217 12 21 16 0
+217 18 19 8 0
+217 -16 18 -11 0
+217 -4 17 -11 0
+217 -16 23 -4 0
+217 -11 1 2 0
+217 18 -4 -12 0
+217 -2 -6 -3 0
+217 -7 18 -23 0
+217 -10 23 8 0
+217 -23 21 4 0
+217 -7 5 13 0
+217 -8 1 -7 0
+217 18 8 11 0
+217 -9 -6 -1 0
+217 -15 8 -2 0
+217 -7 23 -21 0
+217 -4 16 -21 0
+217 -18 -11 -14 0
+217 18 -3 21 0
+217 -8 -6 -7 0
+217 -16 23 -13 0
+217 19 -8 23 0
+217 17 -20 -19 0
+8 -12 0
+8 -9 -13 0
+3 -5 0
+2 -21 0
+1 16 0
+1 14 0
+4 6 13 0
+5 -2 0
+6 17 0
+1 3 0
+4 14 -5 0
+6 -20 14 0
+9 1 0
+1 -23 0
+4 20 1 0
+5 1 0
+9 -7 15 0
+4 -9 0
+7 16 0
+9 -20 0
+4 16 0
+1 -22 0
+6 6 0
+9 -11 0
+7 11 -1 0
+1 17 8 0
+1 3 0
+6 -16 13 0
+6 7 0
+3 -13 7 0
+6 -3 -20 0
+9 15 0
+1 -20 21 0
+7 -13 0
+6 11 0
+5 8 10 0
+6 -23 0
+1 -18 0
+9 18 0
+6 -23 -10 0
+2 -15 0
+5 -10 0
+5 23 0
+3 9 0
+4 20 0
+"""
+
+flags = "--maxsat-minimize-threads=2"
+
+output = """
+o 73
+"""
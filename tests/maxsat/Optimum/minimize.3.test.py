@@ -0,0 +1,209 @@
+input = """
+p wcnf 40 200 361
+361 -7 -5 24 0
+361 -39 -11 -38 0
+361 -22 -40 20 0
+361 -40 6 -34 0
+361 -34 -16 1 0
+361 -10 31 7 0
+361 -30 -6 8 0
+361 -23 -30 -27 0
+361 12 -28 17 0
+361 16 -34 37 0
+361 -10 28 16 0
+361 34 37 -23 0
+361 10 29 -5 0
+361 1 -10 25 0
+361 3 22 -17 0
+361 -35 14 -19 0
+361 -12 2 -34 0
+361 3 -7 -34 0
+361 -19 -1 -27 0
+361 29 -21 12 0
+361 -38 21 40 0
+361 -37 16 14 0
+361 38 -8 -24 0
+361 -4 33 26 0
+361 -15 38 23 0
+361 -36 38 17 0
+361 -4 -33 -25 0
+361 -18 -28 -8 0
+361 38 -29 16 0
+361 30 -17 18 0
+361 -5 -23 32 0
+361 34 20 1 0
+361 33 22 -17 0
+361 -3 19 -5 0
+361 4 -12 -11 0
+361 39 -14 -8 0
+361 -4 33 -35 0
+361 33 -17 -10 0
+361 1 -38 -12 0
+361 -34 4 1 0
+361 -28 25 -10 0
+361 -13 37 -12 0
+361 38 -6 -2 0
+361 -25 -11 19 0
+361 22 18 21 0
+361 2 22 -9 0
+361 24 2 9 0
+361 -35 3 26 0
+361 -36 -3 30 0
+361 -31 -3 -16 0
+361 -11 8 28 0
+361 22 2 40 0
+361 -2 1 -11 0
+361 -29 -31 7 0
+361 27 37 40 0
+361 -8 33 -15 0
+361 -3 -36 -22 0
+361 4 -7 -9 0
+361 -24 -3 -37 0
+361 35 27 -39 0
+361 -18 1 -6 0
+361 26 -22 11 0
+361 17 24 31 0
+361 13 34 11 0
+361 -20 14 32 0
+361 24 -5 33 0
+361 3 38 -1 0
+361 -30 -7 -23 0
+361 12 -29 -35 0
+361 12 -37 24 0
+361 30 -3 -28 0
+361 36 -32 26 0
+361 -2 -8 3 0
+361 -25 -24 -30 0
+361 16 -38 33 0
+361 -21 34 20 0
+361 28 -36 -13 0
+361 -21 34 -13 0
+361 -20 19 -13 0
+361 34 31 -9 0
+361 -21 -37 -10 0
+361 24 36 -2 0
+361 -7 -23 -19 0
+361 21 -3 4 0
+361 11 -33 7 0
+361 -9 15 -23 0
+361 -28 27 24 0
+361 -30 26 12 0
+361 -25 20 -3 0
+361 24 14 -29 0
+361 35 12 33 0
+361 -33 8 13 0
+361 -26 2 21 0
+361 -15 -19 21 0
+361 27 22 -4 0
+361 -7 1 -10 0
+361 24 -22 -36 0
+361 -12 -29 -30 0
+361 7 17 36 0
+361 -3 -19 -5 0
+361 16 -32 9 0
+361 7 28 6 0
+361 -8 14 -10 0
+361 11 13 -24 0
+361 35 27 24 0
+361 -34 -12 -17 0
+361 -25 -2 -12 0
+361 -4 8 -40 0
+361 23 -40 -37 0
+361 6 -27 -31 0
+361 -16 -9 -31 0
+361 11 31 -6 0
+361 22 -36 -18 0
+361 -15 13 -35 0
+361 5 -35 22 0
+361 -5 -36 31 0
+361 20 -35 -40 0
+361 -6 35 -36 0
+361 -33 -32 23 0
+361 -28 -9 -38 0
+361 -15 -24 -3 0
+361 -12 -21 -33 0
+361 13 -24 -17 0
+361 8 -11 -34 0
+361 3 24 -14 0
+361 15 -31 -32 0
+361 -29 -2 -31 0
+361 -32 -36 31 0
+361 -2 12 -29 0
+361 1 -4 -31 0
+361 -12 -39 4 0
+361 -27 6 28 0
+361 -29 18 -6 0
+6 23 0
+8 -8 0
+1 35 13 0
+7 13 0
+9 -12 0
+4 -15 0
+1 -9 0
+8 -22 0
+3 -9 0
+9 8 0
+8 30 -39 0
+1 -7 0
+8 -32 0
+8 35 -22 0
+9 20 0
+5 -24 -8 0
+9 -9 0
+5 10 -4 0
+6 -10 0
+4 19 0
+1 37 0
+5 -37 -2 0
+5 -25 -38 0
+6 -6 0
+2 -37 0
+9 24 -10 0
+3 4 0
+9 27 0
+5 -32 -4 0
+1 -14 -39 0
+8 10 0
+5 -12 10 0
+7 -17 0
+8 22 10 0
+6 29 0
+7 -39 25 0
+2 -39 -35 0
+2 19 0
+6 8 38 0
+2 -7 0
+4 30 -14 0
+2 -3 0
+8 26 0
+9 -5 0
+8 29 0
+7 35 -23 0
+7 5 0
+9 24 -38 0
+2 -12 0
+5 18 0
+1 14 0
+2 6 -10 0
+2 21 0
+1 18 -26 0
+9 25 5 0
+8 -12 0
+7 -10 0
+4 7 0
+4 -31 -32 0
+3 20 0
+7 11 40 0
+4 39 -31 0
+8 3 0
+5 -20 0
+3 12 0
+8 -30 24 0
+5 -18 0
+"""
+
+flags = "--maxsat-minimize-threads=3"
+
+output = """
+o 90
+"""
@@ -0,0 +1,15 @@
+input = """
+p wcnf 3 6 10
+10 1 2 0
+10 -1 0
+10 -2 3 0
+10 -3 0
+4 -2 0
+1 3 0
+"""
+
+flags = "--mode=portfolio -t=3"
+
+output = """
+UNSATISFIABLE
+"""
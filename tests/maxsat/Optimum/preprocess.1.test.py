@@ -0,0 +1,29 @@
+input = """
+p wcnf 13 22 108
+108 3 7 0
+4 1 -4 0
+6 -5 2 0
+3 -6 0
+6 5 -4 -2 0
+2 -6 0
+7 -5 0
+7 2 0
+9 -3 -1 0
+2 -5 0
+2 4 0
+3 2 0
+1 2 0
+1 -6 0
+6 6 0
+10 -2 3 4 0
+7 -5 0
+9 -6 -5 0
+5 -5 -4 3 0
+6 3 2 0
+6 -1 -6 0
+5 -2 4 -5 0
+"""
+
+output = """
+o 8
+"""
@@ -0,0 +1,28 @@
+input = """
+p wcnf 7 21 22
+22 3 -1 6 0
+22 -6 -7 0
+22 3 -6 0
+22 3 5 4 0
+22 -1 5 -6 0
+22 3 0
+22 -7 -3 5 0
+22 -2 1 6 0
+22 -1 -3 0
+22 6 -4 0
+1 -2 1 -3 0
+2 -1 0
+2 -3 2 0
+1 1 0
+1 3 0
+1 -2 -3 0
+3 3 -2 -1 0
+3 3 0
+1 -2 -3 0
+3 3 0
+3 -3 0
+"""
+
+output = """
+o 6
+"""
@@ -0,0 +1,16 @@
+input = """
+p wcnf 6 9 4731
+4731 2 0
+4731 3 0
+975 -3 2 0
+521 3 -2 0
+746 1 3 -2 0
+908 -3 0
+778 -2 3 1 0
+610 -3 1 0
+192 3 0
+"""
+
+output = """
+o 908
+"""
@@ -0,0 +1,28 @@
+input = """
+p wcnf 10 21 54
+54 -1 -3 0
+54 -4 -9 -5 0
+54 -3 -8 7 0
+54 5 -4 0
+54 7 2 0
+54 6 5 -9 0
+54 2 1 0
+54 7 -5 -3 0
+2 -4 0
+6 4 -5 0
+3 -1 0
+2 -2 0
+3 1 0
+4 3 0
+2 3 4 0
+10 1 0
+4 1 -5 0
+9 -1 0
+1 3 0
+1 4 0
+6 5 0
+"""
+
+output = """
+o 19
+"""
@@ -0,0 +1,23 @@
+input = """
+p wcnf 6 16 13
+13 -2 -4 1 0
+13 3 -5 2 0
+13 6 0
+13 -1 0
+13 3 4 0
+13 2 4 0
+13 6 0
+13 5 -3 -1 0
+2 -3 2 1 0
+1 -1 0
+1 2 3 -1 0
+1 1 0
+1 1 0
+3 3 0
+1 1 -2 -3 0
+2 1 0
+"""
+
+output = """
+o 5
+"""
@@ -0,0 +1,30 @@
+input = """
+p wcnf 10 23 41
+41 5 0
+41 7 0
+41 -4 5 -6 0
+41 3 -9 0
+1 -4 3 -1 0
+1 -4 -3 1 0
+3 -5 0
+1 -3 0
+2 4 0
+3 -5 3 2 0
+2 -4 0
+3 1 3 4 0
+2 3 0
+1 4 -2 0
+3 -4 0
+3 5 -4 0
+2 1 -2 4 0
+3 1 -2 0
+2 1 0
+1 -4 -5 -3 0
+2 5 0
+2 1 0
+3 -2 0
+"""
+
+output = """
+o 6
+"""
@@ -0,0 +1,37 @@
+input = """
+p wcnf 10 28 39
+39 1 0
+39 4 0
+39 6 8 0
+39 -8 -10 4 0
+39 1 -9 -8 0
+39 1 7 6 0
+39 10 3 0
+39 3 -6 4 0
+39 -8 2 -3 0
+39 5 0
+3 -6 -4 2 0
+3 -6 0
+2 -8 0
+3 4 0
+1 10 9 3 0
+3 4 9 -7 0
+1 9 0
+3 2 6 0
+2 -2 -9 0
+1 -5 0
+3 -10 -8 0
+2 4 0
+1 9 -2 -3 0
+3 -2 0
+1 -6 0
+2 4 -1 7 0
+2 2 -7 5 0
+2 -7 0
+"""
+
+flags = "--maxsat-disjcores=wce"
+
+output = """
+o 8
+"""
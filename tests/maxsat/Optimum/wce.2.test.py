@@ -0,0 +1,44 @@
+input = """
+p wcnf 12 35 30
+30 -7 5 0
+30 -4 -7 0
+30 11 -3 0
+30 9 8 0
+30 5 -1 0
+30 -10 0
+30 4 0
+30 -3 11 0
+30 -5 0
+30 -12 10 0
+30 -5 0
+30 3 -6 12 0
+30 11 0
+30 -8 0
+30 9 0
+30 2 11 0
+30 8 7 -5 0
+30 3 2 0
+30 -8 0
+3 -3 -2 1 0
+1 11 -8 3 0
+3 -3 8 0
+1 6 0
+1 -9 0
+1 -5 0
+1 -3 -4 0
+1 1 10 0
+3 -10 6 -9 0
+3 -2 0
+1 7 6 0
+3 -7 0
+1 -4 0
+2 3 0
+3 -2 4 -3 0
+1 -1 0
+"""
+
+flags = "--maxsat-disjcores=wce"
+
+output = """
+o 7
+"""
@@ -0,0 +1,42 @@
+input = """
+p wcnf 11 33 124
+124 10 -2 5 0
+124 5 -8 6 0
+124 -9 1 8 0
+124 -7 -1 0
+124 3 0
+124 10 0
+124 10 -7 2 0
+124 9 -6 7 0
+124 2 9 -8 0
+124 -4 0
+124 -9 7 8 0
+124 -6 0
+6 6 0
+8 -10 0
+8 1 -4 5 0
+5 -6 0
+8 -5 -10 0
+2 -6 8 0
+2 8 9 0
+10 -5 7 0
+9 5 0
+4 -6 8 -10 0
+6 -6 0
+3 -2 7 -9 0
+7 3 0
+6 6 0
+2 8 0
+6 10 0
+1 -9 0
+6 9 0
+5 -9 0
+10 1 -9 -5 0
+9 -7 0
+"""
+
+flags = "--maxsat-disjcores=wce"
+
+output = """
+o 39
+"""
@@ -0,0 +1,18 @@
+input = """
+p wcnf 7 9 10
+10 -1 -6 0
+10 6 -2 0
+10 -3 -7 0
+10 7 -4 0
+1 1 0
+1 2 0
+1 3 0
+1 4 0
+1 5 0
+"""
+
+flags = "--maxsat-disjcores=wce --no-maxsat-preprocess"
+
+output = """
+o 2
+"""
@@ -0,0 +1,18 @@
+# the optimum and the model are checked as in maxsat/Optimum; here, checker is still the path of this file
+exec(open(os.path.join(os.path.dirname(checker), "maxsatOptimum.checker.py")).read())
+optimumChecker = checker
+
+def checker(actualOutput, actualError):
+    global args
+    global input
+    global output
+
+    # a deterministic run must print the same lines, in the same order, each time it is repeated
+    for run in range(3):
+        process = subprocess.Popen(args, stdin=subprocess.PIPE, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+        (out, err) = process.communicate(input.strip().encode(), timeout=timeout)
+        if out.decode() != actualOutput:
+            reportFailure(actualOutput, "Run %d printed: %s" % (run + 2, out.decode()))
+            return
+
+    optimumChecker(actualOutput, actualError)
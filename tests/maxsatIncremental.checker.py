@@ -0,0 +1,64 @@
+def decodeCalls(string):
+    # for each solve command: the hard clauses, the assumptions and the soft clauses not removed so far
+    hard = []
+    soft = []
+    removed = set()
+    calls = []
+    for line in string.strip().split("\n"):
+        words = line.split()
+        if len(words) == 0 or words[0] == "c":
+            continue
+        if words[0] == "h":
+            hard.append([int(lit) for lit in words[1:-1]])
+        elif words[0] == "s":
+            soft.append((int(words[1]), [int(lit) for lit in words[2:-1]]))
+        elif words[0] == "r":
+            removed.add(int(words[1]) - 1)
+        elif words[0] == "a":
+            assumptions = [[int(lit)] for lit in words[1:-1]]
+            calls.append((hard + assumptions, [soft[i] for i in range(len(soft)) if i not in removed]))
+    return calls
+
+def decodeResults(string):
+    results = []
+    lines = string.split("\n")
+    for i in range(len(lines)):
+        if lines[i] == "s UNSATISFIABLE":
+            results.append(("UNSATISFIABLE", None))
+        elif lines[i].startswith("o ") and i + 2 < len(lines) and lines[i+2].startswith("v"):
+            results.append((lines[i], set(int(lit) for lit in lines[i+2].split()[1:])))
+    return results
+
+def satisfied(clause, model):
+    return any(lit in model or (-lit not in model and lit < 0) for lit in clause)
+
+def checker(actualOutput, actualError):
+    global input
+    global output
+
+    if actualError:
+        reportFailure(output, actualError)
+        return
+
+    if not actualOutput:
+        reportFailure(output, "No output stream!")
+        return
+
+    # each model must satisfy the hard clauses and the assumptions of its call, and cost exactly the optimum of that call
+    expected = [line.strip() for line in output.strip().split("\n")]
+    results = decodeResults(actualOutput)
+    calls = decodeCalls(input)
+    if [result for (result, model) in results] != expected:
+        reportFailure(expected, [result for (result, model) in results])
+        return
+    for i in range(len(results)):
+        (result, model) = results[i]
+        if model is None:
+            continue
+        (hard, soft) = calls[i]
+        violated = [clause for clause in hard if not satisfied(clause, model)]
+        cost = sum(weight for (weight, clause) in soft if not satisfied(clause, model))
+        if len(violated) > 0 or "o %d" % (cost,) != result:
+            reportFailure(expected, "Call %d: model of cost %d violating %s" % (i + 1, cost, violated))
+            return
+    reportSuccess(expected, expected)
@@ -0,0 +1,74 @@
+def decodeInstance(string):
+    # soft clauses are grouped by level, from the highest priority; a level directive without soft clauses has no cost
+    top = None
+    hard = []
+    levels = {}
+    priority = 0
+    for line in string.strip().split("\n"):
+        words = line.split()
+        if len(words) == 0 or words[0] == "c":
+            continue
+        if words[0] == "p":
+            if len(words) > 4:
+                top = int(words[4])
+            continue
+        if words[0] == "l":
+            priority = int(words[1])
+            continue
+        weight = int(words[0])
+        lits = [int(lit) for lit in words[1:-1]]
+        if top is not None and weight >= top:
+            hard.append(lits)
+        else:
+            levels.setdefault(priority, []).append((weight, lits))
+    return (hard, [levels[p] for p in sorted(levels, reverse=True)])
+
+def decodeModel(string):
+    lines = [line for line in string.split("\n") if line.startswith("v")]
+    if len(lines) != 1:
+        return None
+    return set(int(lit) for lit in lines[0].split()[1:])
+
+def satisfied(clause, model):
+    return any(lit in model or (-lit not in model and lit < 0) for lit in clause)
+
+def checker(actualOutput, actualError):
+    global input
+    global output
+
+    if actualError:
+        reportFailure(output, actualError)
+        return
+
+    if not actualOutput:
+        reportFailure(output, "No output stream!")
+        return
+
+    # the printed model is checked against the input: it must satisfy the hard clauses, and its cost must be the optimum
+    expected = output.strip()
+    if expected == "UNSATISFIABLE":
+        if "UNSATISFIABLE" not in actualOutput or decodeModel(actualOutput) is not None:
+            reportFailure(expected, actualOutput)
+        else:
+            reportSuccess(expected, expected)
+        return
+
+    bounds = [line for line in actualOutput.split("\n") if line.startswith("o ")]
+    model = decodeModel(actualOutput)
+    if "s OPTIMUM FOUND" not in actualOutput or len(bounds) == 0 or bounds[-1] != expected:
+        reportFailure(expected, bounds)
+        return
+    if model is None:
+        reportFailure(expected, "No model!")
+        return
+
+    (hard, levels) = decodeInstance(input)
+    violated = [clause for clause in hard if not satisfied(clause, model)]
+    costs = [sum(weight for (weight, clause) in soft if not satisfied(clause, model)) for soft in levels]
+    cost = "o " + " ".join(str(c) for c in (costs if len(costs) > 0 else [0]))
+    if len(violated) > 0:
+        reportFailure(expected, "Violated hard clauses: %s" % (violated,))
+    elif cost != expected:
+        reportFailure(expected, "Model of cost %s" % (cost[2:],))
+    else:
+        reportSuccess(expected, bounds[-1])
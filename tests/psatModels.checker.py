@@ -0,0 +1,86 @@
+def decodeModels(string):
+    models = []
+
+    model = set()
+    for line in string.split("\n"):
+        line = line.strip()
+        if len(line) == 0: continue
+        if line[0] == 'v':
+            model = model | set(line[2:].split(" "))
+        elif line[0] == 'c' and len(model) > 0:
+            models.append(model)
+            model = set()
+
+    if len(model) > 0:
+        models.append(model)
+    return models
+
+def decodeCore(string):
+    for line in string.split("\n"):
+        if line.startswith("c Cube core:"):
+            return line.split()[3:]
+    return None
+
+def decodeVars():
+    global input
+    for line in input.strip().split("\n"):
+        if line.startswith("p "):
+            return int(line.split()[2])
+    return 0
+
+def checkModel(model):
+    global input
+    for clause in input.split("\n"):
+        if clause and clause[0] != 'c' and clause[0] != 'p':
+            sat = False
+            for lit in clause.split(" "):
+                if lit != '0' and lit in model:
+                    sat = True
+                    break
+            if not sat:
+                return False
+    return True
+
+def checker(actualOutput, actualError):
+    global output
+
+    if actualError:
+        reportFailure(output, actualError)
+        return
+
+    if not actualOutput:
+        reportFailure(output, "No output stream!")
+        return
+
+    # each line of the expected output is checked: sat, unsat, "models <count>" for enumeration, or "core <literals>" for a cube core
+    expected = [line.strip().lower() for line in output.strip().split("\n")]
+    models = decodeModels(actualOutput)
+    core = decodeCore(actualOutput)
+    for model in models:
+        if not checkModel(model):
+            reportFailure(expected, "%s; wrong model: %s" % (models, model))
+            return
+    if len(set(frozenset(model) for model in models)) != len(models):
+        reportFailure(expected, "%s; repeated models" % (models,))
+        return
+    if core is not None:
+        coreVars = [abs(int(lit)) for lit in core]
+        if len(set(coreVars)) != len(coreVars) or max(coreVars) > decodeVars():
+            reportFailure(expected, "wrong cube core: %s" % (core,))
+            return
+
+    for line in expected:
+        words = line.split()
+        if words[0] == "sat" and len(models) == 0:
+            reportFailure(expected, "UNSATISFIABLE")
+            return
+        if words[0] == "unsat" and (len(models) > 0 or "UNSATISFIABLE" not in actualOutput):
+            reportFailure(expected, models)
+            return
+        if words[0] == "models" and (len(models) != int(words[1]) or "c Models %s" % (words[1],) not in actualOutput):
+            reportFailure(expected, "%d models" % (len(models),))
+            return
+        if words[0] == "core" and (core is None or sorted(core) != sorted(words[1:])):
+            reportFailure(expected, "cube core: %s" % (core,))
+            return
+    reportSuccess(expected, expected)
@@ -0,0 +1,424 @@
+input = """
+c num blocks = 1
+c num vars = 100
+c minblockids[0] = 1
+c maxblockids[0] = 100
+p cnf 100 415
+-71 -62 -94 0
+-33 -74 93 0
+16 -58 -2 0
+-65 -69 56 0
+12 -46 -68 0
+6 14 7 0
+-39 -31 -87 0
+-47 -71 75 0
+11 -85 -8 0
+-49 -64 63 0
+-8 -1 15 0
+-21 -60 -40 0
+-68 -71 -85 0
+-68 49 -55 0
+51 17 -40 0
+-51 -82 -59 0
+-53 45 -41 0
+85 -44 34 0
+-12 46 -66 0
+100 -19 -93 0
+-75 -32 82 0
+78 -31 70 0
+26 -65 -74 0
+-57 88 -51 0
+18 94 48 0
+-71 62 -83 0
+9 -91 -36 0
+15 -66 78 0
+41 -71 42 0
+99 -70 61 0
+-15 59 39 0
+24 -10 -99 0
+2 -52 -93 0
+-18 -42 74 0
+40 46 58 0
+-89 99 13 0
+-2 20 22 0
+70 29 -92 0
+-52 -26 20 0
+-96 86 -2 0
+12 -73 -55 0
+-58 89 16 0
+-61 -78 -32 0
+89 -47 17 0
+71 16 67 0
+-93 -22 -30 0
+-91 -14 95 0
+-53 -27 48 0
+63 2 -22 0
+46 -13 -99 0
+-21 -98 -23 0
+23 93 68 0
+46 73 -11 0
+62 -84 83 0
+-71 -40 4 0
+-59 -35 64 0
+26 -35 -98 0
+90 -78 66 0
+-53 -50 79 0
+64 33 62 0
+64 2 39 0
+32 -87 -19 0
+-41 -12 13 0
+21 -43 -98 0
+66 96 -72 0
+37 87 -47 0
+65 22 61 0
+90 -63 32 0
+100 2 -52 0
+-41 77 -5 0
+100 -71 -47 0
+-72 30 95 0
+29 -25 94 0
+17 -93 47 0
+-23 -13 39 0
+64 76 43 0
+73 17 63 0
+2 91 31 0
+36 28 63 0
+55 39 93 0
+77 72 -80 0
+-64 35 -28 0
+41 -58 -72 0
+-85 98 -99 0
+-62 91 15 0
+-71 -99 39 0
+-12 -78 47 0
+59 23 -50 0
+49 69 99 0
+87 -71 77 0
+13 35 -43 0
+-12 -49 50 0
+-18 -62 -94 0
+-60 1 57 0
+9 -74 -91 0
+-36 -90 -82 0
+-2 31 10 0
+-65 -90 -59 0
+64 -40 27 0
+10 84 57 0
+71 -3 31 0
+40 78 -86 0
+-94 28 -37 0
+61 100 -59 0
+1 22 8 0
+27 -76 94 0
+-94 86 80 0
+57 88 -12 0
+36 41 86 0
+-82 -62 -88 0
+26 -27 -15 0
+27 59 -98 0
+38 69 14 0
+-96 -13 8 0
+-46 -97 74 0
+81 -45 21 0
+33 -88 17 0
+35 5 -4 0
+90 -83 89 0
+65 36 13 0
+25 -52 -65 0
+-58 63 -10 0
+85 -19 99 0
+40 69 15 0
+41 -91 39 0
+71 -86 47 0
+-19 30 -67 0
+54 33 12 0
+-32 24 -99 0
+-40 -2 -58 0
+-60 30 12 0
+-46 85 -33 0
+-88 74 22 0
+42 46 -30 0
+35 86 -77 0
+-49 94 35 0
+-91 81 -74 0
+85 44 63 0
+45 68 -20 0
+-75 -40 -32 0
+99 7 50 0
+41 33 -19 0
+22 -33 -70 0
+17 84 -70 0
+53 15 -5 0
+41 49 -65 0
+3 46 72 0
+-40 2 78 0
+21 59 -31 0
+-2 69 62 0
+68 61 49 0
+12 91 21 0
+72 55 50 0
+55 -7 -40 0
+-37 -77 -80 0
+-50 39 71 0
+14 51 -10 0
+87 -78 69 0
+-88 -84 45 0
+-50 27 43 0
+-24 -44 68 0
+7 77 75 0
+97 -63 -22 0
+-65 -16 96 0
+-71 -47 69 0
+57 94 -4 0
+59 -90 -96 0
+-75 -90 93 0
+-53 84 98 0
+87 -78 -9 0
+-15 -25 -23 0
+19 34 1 0
+-47 -45 43 0
+69 -88 99 0
+92 -84 -24 0
+-89 27 -21 0
+47 -81 -20 0
+57 -46 27 0
+20 -92 -69 0
+-27 -11 78 0
+80 -100 -69 0
+88 -91 92 0
+73 -9 67 0
+45 13 99 0
+-7 71 -55 0
+-69 -82 7 0
+92 83 -64 0
+-99 71 -72 0
+-47 100 -33 0
+-42 100 67 0
+-26 -9 4 0
+65 -70 23 0
+20 -85 -80 0
+-13 64 -51 0
+-20 78 -16 0
+61 65 50 0
+19 58 -24 0
+-17 -33 -49 0
+84 20 63 0
+64 -69 -51 0
+-12 -66 -14 0
+68 -38 30 0
+-21 -89 -74 0
+69 -95 -60 0
+8 21 -42 0
+-77 -43 32 0
+-92 -26 89 0
+54 43 -10 0
+-100 -57 36 0
+-23 35 -97 0
+-23 65 -84 0
+57 46 5 0
+37 90 -88 0
+62 54 71 0
+-21 -40 100 0
+68 -87 -23 0
+68 48 40 0
+-32 34 -99 0
+-24 36 -16 0
+-67 59 -61 0
+-82 -45 -55 0
+-80 -82 -45 0
+-60 -50 -5 0
+-62 64 -58 0
+-51 -68 57 0
+9 -57 41 0
+-60 84 59 0
+-26 -55 22 0
+70 -21 50 0
+6 22 -81 0
+27 31 -3 0
+77 -9 -45 0
+-37 29 97 0
+28 98 -59 0
+-40 64 72 0
+66 42 34 0
+41 58 83 0
+-90 -86 -50 0
+-72 -73 49 0
+30 23 5 0
+90 -24 16 0
+-19 -23 98 0
+22 44 1 0
+33 89 87 0
+-11 31 28 0
+16 32 91 0
+1 86 95 0
+-81 -36 -7 0
+-70 -92 44 0
+39 -61 17 0
+74 -21 41 0
+-62 -30 -49 0
+10 -27 57 0
+80 34 57 0
+-85 -49 74 0
+16 -86 47 0
+-42 27 -68 0
+-44 15 -64 0
+2 -35 -17 0
+-24 -4 81 0
+-94 33 -47 0
+-49 9 -66 0
+-49 -97 -4 0
+-66 -48 -62 0
+22 -65 -23 0
+61 -94 -7 0
+93 -30 -48 0
+-25 39 1 0
+26 99 -32 0
+76 26 74 0
+-15 31 -67 0
+-19 -68 26 0
+-55 -36 47 0
+-20 -65 -64 0
+-94 -55 77 0
+67 -47 29 0
+71 -21 85 0
+24 -41 -69 0
+-62 71 -18 0
+-62 50 -33 0
+-47 41 9 0
+75 -51 30 0
+81 88 -74 0
+-96 44 -23 0
+-60 -97 -23 0
+-66 -24 -10 0
+55 41 -76 0
+-56 -88 91 0
+-97 35 28 0
+-41 -96 32 0
+77 -28 99 0
+5 -82 -24 0
+-69 58 86 0
+50 66 -11 0
+-67 75 -4 0
+90 -39 -69 0
+6 -86 -69 0
+-58 -97 55 0
+67 11 -24 0
+88 77 97 0
+44 -32 -1 0
+25 48 18 0
+8 -52 18 0
+-56 -90 -21 0
+60 53 4 0
+86 41 23 0
+-57 -26 -97 0
+40 49 -54 0
+23 -31 84 0
+-42 51 91 0
+5 72 -47 0
+-49 42 -64 0
+-92 16 -95 0
+-68 80 -97 0
+-45 -60 -4 0
+-92 -53 -86 0
+92 -31 86 0
+54 -88 -12 0
+-34 -46 70 0
+42 61 -14 0
+56 -98 -52 0
+-100 47 53 0
+-68 22 -48 0
+94 64 -15 0
+40 13 -58 0
+-71 37 -67 0
+-81 18 -38 0
+-9 -28 -62 0
+51 62 54 0
+23 14 63 0
+17 100 -77 0
+61 7 -60 0
+58 -91 49 0
+21 55 -32 0
+-54 71 49 0
+-54 2 -75 0
+33 -87 59 0
+-44 61 50 0
+36 -15 65 0
+17 20 -31 0
+81 94 -55 0
+-87 85 48 0
+-64 -4 58 0
+52 -11 -93 0
+-26 -37 6 0
+-97 -73 -48 0
+-85 -54 -87 0
+87 -75 68 0
+-43 -22 -94 0
+-79 -68 -62 0
+-38 91 -89 0
+-68 -78 -88 0
+65 83 -56 0
+50 -43 -17 0
+51 60 -14 0
+39 -40 17 0
+55 32 -60 0
+-94 -50 60 0
+66 -5 -14 0
+63 -29 -33 0
+-40 3 23 0
+-28 88 -99 0
+53 33 48 0
+30 -67 -14 0
+25 22 26 0
+83 59 -18 0
+41 84 -37 0
+-33 -54 -19 0
+-92 -26 -30 0
+-97 -35 -95 0
+91 -48 86 0
+22 76 29 0
+-49 33 52 0
+-38 16 81 0
+-46 -89 1 0
+61 -14 42 0
+-18 -98 51 0
+4 91 -55 0
+-87 65 -17 0
+97 88 -37 0
+55 53 -60 0
+100 -76 4 0
+64 -78 -14 0
+-63 -53 -62 0
+-31 57 -100 0
+-89 -93 72 0
+63 38 -99 0
+-67 -3 42 0
+-82 83 32 0
+43 -81 -2 0
+6 -97 48 0
+4 50 -9 0
+-91 -65 -94 0
+-20 74 -21 0
+32 21 -86 0
+-69 67 -61 0
+1 87 -92 0
+-98 -70 -10 0
+14 -71 51 0
+-60 26 77 0
+42 -28 81 0
+97 -41 78 0
+-26 -10 -74 0
+-58 -79 17 0
+-30 -6 49 0
+-64 23 22 0
+-97 95 94 0
+-55 -82 -83 0
+28 82 55 0
+-50 -87 -77 0
+92 94 -26 0
+-33 20 70 0
+57 -21 -23 0
+31 -43 74 0
+-86 46 -32 0
+"""
+
+output = "UNSAT"
@@ -0,0 +1,434 @@
+input = """
+c num blocks = 1
+c num vars = 100
+c minblockids[0] = 1
+c maxblockids[0] = 100
+p cnf 100 425
+83 -75 -60 0
+-30 -63 79 0
+93 -88 -33 0
+-43 -41 76 0
+65 34 -45 0
+-43 -93 40 0
+75 99 1 0
+-24 88 -81 0
+54 -76 44 0
+-14 2 80 0
+-72 -18 -98 0
+-88 66 -77 0
+53 -92 39 0
+-81 99 -86 0
+-16 -83 -58 0
+3 -70 -67 0
+-28 1 91 0
+60 -11 -23 0
+10 49 -13 0
+-1 60 -5 0
+-57 91 -22 0
+-31 14 77 0
+47 57 -92 0
+32 -83 -5 0
+-91 85 26 0
+-40 -13 29 0
+-50 -24 18 0
+95 32 -58 0
+46 81 32 0
+-35 11 -84 0
+-89 69 76 0
+12 -63 -90 0
+2 -57 -6 0
+-98 71 -62 0
+3 78 -94 0
+50 96 -41 0
+86 -71 -90 0
+-34 -18 9 0
+-66 92 -52 0
+-89 -9 44 0
+65 -27 34 0
+86 91 -77 0
+81 46 -56 0
+29 -57 59 0
+-75 -35 52 0
+-75 59 -46 0
+12 93 -1 0
+94 -27 -68 0
+-51 -62 -98 0
+85 60 49 0
+51 -92 3 0
+-53 58 10 0
+78 -24 -99 0
+38 76 -12 0
+-85 -99 42 0
+15 63 -10 0
+48 93 66 0
+-69 43 -94 0
+15 -8 -83 0
+-69 -78 -84 0
+-17 -62 1 0
+41 35 -99 0
+-47 3 94 0
+-34 20 -14 0
+26 -21 -4 0
+-57 -90 -89 0
+22 -89 -51 0
+80 -72 -62 0
+79 23 -42 0
+71 -3 67 0
+22 48 85 0
+61 -83 67 0
+-34 -61 77 0
+19 66 33 0
+16 88 -58 0
+-85 45 -16 0
+-13 33 -53 0
+-90 -83 -46 0
+-50 87 70 0
+-62 61 -55 0
+-96 7 25 0
+72 -43 -9 0
+80 66 -67 0
+43 58 -94 0
+-27 -44 -62 0
+92 43 -100 0
+-90 -76 21 0
+26 -62 12 0
+31 79 -94 0
+98 -74 -25 0
+43 50 -88 0
+-83 64 -59 0
+-87 38 22 0
+24 79 71 0
+-10 20 48 0
+74 56 1 0
+66 40 -38 0
+80 -52 -36 0
+48 -17 38 0
+95 99 -24 0
+-26 89 -62 0
+-26 -73 -39 0
+95 81 -47 0
+-56 -93 -45 0
+21 -99 65 0
+78 -69 93 0
+-89 -82 100 0
+-34 100 23 0
+93 -31 -11 0
+98 94 92 0
+-40 4 -9 0
+10 55 63 0
+-14 -100 -69 0
+28 61 -85 0
+-14 52 -64 0
+-38 -26 100 0
+-20 -63 87 0
+6 64 50 0
+3 51 -53 0
+97 37 -13 0
+62 -99 -36 0
+-91 -53 78 0
+-30 87 40 0
+73 33 17 0
+-49 -60 89 0
+79 69 4 0
+-39 -71 -27 0
+47 -94 54 0
+-16 -84 95 0
+-89 21 33 0
+49 -8 1 0
+85 -5 65 0
+-7 61 -6 0
+-43 -54 -45 0
+68 -20 44 0
+-59 11 -82 0
+-11 -73 62 0
+-63 -99 -16 0
+-66 89 80 0
+88 32 -60 0
+-28 -96 11 0
+-72 -60 48 0
+-40 2 30 0
+-32 13 87 0
+40 -88 -82 0
+63 -42 -35 0
+90 -34 -12 0
+19 -35 71 0
+-31 -40 89 0
+6 5 -29 0
+-80 -90 -17 0
+-87 -75 31 0
+44 -17 -1 0
+-5 32 89 0
+-100 -67 2 0
+15 57 -68 0
+35 -23 93 0
+-49 24 85 0
+47 -44 23 0
+19 74 -36 0
+74 -47 4 0
+43 -33 -41 0
+-81 -57 31 0
+-95 -73 16 0
+-55 -27 -12 0
+5 52 95 0
+-28 88 46 0
+-68 -52 -19 0
+51 -22 52 0
+34 -53 -8 0
+-80 79 -57 0
+-36 42 98 0
+66 61 -11 0
+2 -28 23 0
+81 53 22 0
+39 -61 92 0
+-35 -25 -11 0
+-78 47 4 0
+-67 29 -70 0
+64 69 87 0
+88 5 32 0
+19 -70 62 0
+57 -71 -59 0
+69 19 -97 0
+66 20 -18 0
+-60 -83 18 0
+78 38 63 0
+31 -23 53 0
+3 95 -77 0
+11 76 92 0
+75 -77 -57 0
+97 98 58 0
+64 -21 6 0
+-100 -14 76 0
+-33 87 75 0
+28 -88 91 0
+-44 -75 -99 0
+100 -44 17 0
+-85 -53 -47 0
+67 66 25 0
+35 55 80 0
+36 -26 65 0
+-82 46 -1 0
+85 90 7 0
+69 -94 -91 0
+30 84 52 0
+-3 82 -7 0
+3 -50 92 0
+-64 78 61 0
+13 58 74 0
+73 -77 97 0
+31 -19 17 0
+-15 -23 -8 0
+1 90 -75 0
+-47 46 8 0
+-64 -43 22 0
+-69 -86 -100 0
+37 9 10 0
+85 61 28 0
+1 -72 -16 0
+6 -72 64 0
+-4 51 -22 0
+-1 -46 34 0
+-26 3 76 0
+-90 85 -4 0
+-34 29 44 0
+21 59 54 0
+13 86 -14 0
+-93 27 -77 0
+-72 45 -15 0
+79 -74 -13 0
+80 -68 -86 0
+50 98 46 0
+-27 100 -61 0
+52 -14 89 0
+-74 -68 57 0
+51 31 22 0
+-100 -73 -58 0
+83 69 91 0
+29 72 -10 0
+2 57 -14 0
+79 99 -7 0
+36 -20 29 0
+27 -65 78 0
+57 20 41 0
+18 83 -37 0
+-82 -71 -61 0
+-46 34 -65 0
+-83 -27 -92 0
+-74 4 -96 0
+76 -49 87 0
+-55 -31 -73 0
+62 -4 67 0
+-40 99 -47 0
+46 -94 48 0
+-93 27 81 0
+-52 30 48 0
+16 -45 -4 0
+-27 -59 -38 0
+-52 81 -21 0
+70 27 97 0
+-17 -39 88 0
+99 97 33 0
+-6 58 79 0
+26 42 -64 0
+-33 44 39 0
+-57 79 78 0
+52 -100 -42 0
+-17 84 -29 0
+99 76 12 0
+-10 -100 57 0
+-21 92 -6 0
+-10 -88 -57 0
+92 -37 -81 0
+90 -65 -66 0
+36 46 94 0
+-28 -76 -27 0
+-56 -28 -4 0
+-37 -46 -28 0
+46 -84 93 0
+-89 20 -61 0
+72 -17 96 0
+-44 -92 -10 0
+76 -24 73 0
+6 3 -52 0
+80 -74 43 0
+-47 -72 78 0
+-49 29 7 0
+-82 66 -78 0
+-71 16 96 0
+-13 33 14 0
+-78 -28 63 0
+45 3 -1 0
+-32 65 29 0
+-1 45 -7 0
+-27 -53 -39 0
+-86 73 -54 0
+25 -65 29 0
+29 -11 50 0
+-5 49 54 0
+-5 20 38 0
+98 -77 79 0
+7 -93 -56 0
+80 93 39 0
+1 -93 4 0
+54 -80 36 0
+-46 62 6 0
+-68 -72 -30 0
+20 -92 3 0
+99 9 24 0
+-98 32 23 0
+-43 94 97 0
+35 -64 62 0
+8 28 -63 0
+29 -98 -82 0
+-52 22 -98 0
+-24 96 60 0
+9 -58 -39 0
+95 49 -80 0
+7 69 -42 0
+11 -39 -83 0
+42 -57 -85 0
+6 83 -53 0
+-34 -38 11 0
+-33 66 64 0
+-62 -84 -45 0
+46 60 -35 0
+-36 9 -59 0
+6 -82 8 0
+21 -42 -62 0
+28 96 -56 0
+16 41 65 0
+97 -42 21 0
+-67 86 -25 0
+67 -72 -28 0
+-9 68 37 0
+-54 -75 71 0
+-95 89 -78 0
+14 60 -57 0
+-39 -9 -16 0
+28 -68 40 0
+93 7 -89 0
+4 8 66 0
+97 -3 -4 0
+51 -87 74 0
+15 -80 -46 0
+55 26 -29 0
+26 95 49 0
+76 -72 75 0
+-85 44 7 0
+66 36 91 0
+82 64 31 0
+-62 -20 -85 0
+-34 -39 -21 0
+-26 43 95 0
+36 -43 4 0
+28 -27 -92 0
+-32 18 -90 0
+37 2 26 0
+-82 25 -80 0
+45 -57 -5 0
+71 36 -5 0
+-13 -80 -25 0
+-82 -58 11 0
+45 -52 -8 0
+55 65 -18 0
+52 -10 -94 0
+-4 -93 -35 0
+97 57 29 0
+-76 49 36 0
+38 73 52 0
+57 -95 -63 0
+-4 -12 32 0
+32 74 -30 0
+-66 79 35 0
+-87 24 19 0
+73 68 14 0
+72 -68 -53 0
+11 -21 66 0
+30 -11 -97 0
+59 42 6 0
+-74 66 -91 0
+41 -33 94 0
+53 -32 80 0
+-88 92 93 0
+-83 63 1 0
+-3 -50 46 0
+66 -89 -14 0
+-51 3 29 0
+47 8 -78 0
+69 55 -19 0
+-26 -21 -15 0
+-92 -68 37 0
+85 11 -31 0
+58 7 -92 0
+-34 100 -25 0
+35 62 56 0
+65 79 -42 0
+12 -55 -64 0
+49 42 -82 0
+98 23 56 0
+49 -9 23 0
+22 100 -28 0
+87 -47 83 0
+7 -63 39 0
+35 47 67 0
+-84 -21 57 0
+-72 -76 -26 0
+-27 -87 64 0
+-83 -100 41 0
+-40 5 -21 0
+-84 18 81 0
+-9 -80 -49 0
+16 7 24 0
+68 -7 -98 0
+-34 -1 44 0
+23 92 -55 0
+-34 21 65 0
+-38 44 7 0
+-11 96 -49 0
+-64 45 65 0
+66 45 20 0
+80 -93 -89 0
+1 -65 -40 0
+74 -13 38 0
+"""
+
+output = "SAT"
@@ -0,0 +1,859 @@
+input = """
+c num blocks = 1
+c num vars = 200
+c minblockids[0] = 1
+c maxblockids[0] = 200
+p cnf 200 850
+-85 109 -16 0
+-155 23 76 0
+16 114 -11 0
+-58 -7 26 0
+25 65 -68 0
+-79 64 167 0
+85 10 -148 0
+-60 -186 -106 0
+160 112 -64 0
+66 -47 153 0
+61 -5 116 0
+35 -121 -81 0
+-191 -156 24 0
+95 -99 135 0
+-163 25 -187 0
+-129 -24 -92 0
+-141 182 -145 0
+30 -73 20 0
+-69 122 77 0
+172 -103 -4 0
+65 44 56 0
+179 174 -34 0
+-79 -75 70 0
+-153 72 134 0
+177 71 -4 0
+-185 -140 61 0
+42 -95 -84 0
+-169 -100 170 0
+-79 -197 -167 0
+-132 119 -85 0
+-188 -195 128 0
+-47 107 -169 0
+7 -196 132 0
+-81 68 -99 0
+-58 173 100 0
+-39 -6 -185 0
+183 27 108 0
+64 -87 -190 0
+171 10 62 0
+-180 134 30 0
+-103 197 -154 0
+197 138 131 0
+-59 113 139 0
+120 -143 142 0
+-109 118 -41 0
+-47 -63 -90 0
+117 -142 136 0
+177 -82 29 0
+193 157 147 0
+-30 141 -3 0
+163 -35 -63 0
+100 103 -58 0
+192 42 -61 0
+63 123 3 0
+-151 -26 121 0
+56 -138 200 0
+134 -41 -5 0
+103 96 24 0
+-188 -34 165 0
+19 -97 -51 0
+-124 -111 -162 0
+148 112 167 0
+-47 -107 -165 0
+162 -129 70 0
+188 -87 -52 0
+-38 -100 24 0
+-139 62 -92 0
+-170 -38 -153 0
+-23 181 -86 0
+67 86 -141 0
+-50 72 -77 0
+38 183 -117 0
+-17 -127 -167 0
+-161 173 127 0
+-177 61 -19 0
+-77 79 -131 0
+-34 84 65 0
+70 44 -1 0
+173 127 168 0
+-181 -190 35 0
+-124 -65 -50 0
+138 -81 -161 0
+-15 -58 39 0
+184 -117 -88 0
+-118 -47 20 0
+-61 -182 2 0
+-100 35 -37 0
+-135 56 62 0
+-97 20 14 0
+46 -192 28 0
+-168 6 -142 0
+7 56 160 0
+41 -136 53 0
+-117 169 141 0
+144 165 -86 0
+-124 88 -9 0
+-142 37 -185 0
+135 14 140 0
+-62 -25 -174 0
+57 102 -97 0
+-40 -19 -173 0
+165 153 138 0
+99 5 -111 0
+75 132 -190 0
+-46 193 -148 0
+11 24 48 0
+-113 169 149 0
+-191 -80 87 0
+-118 141 -139 0
+-79 80 23 0
+127 30 9 0
+128 -12 -117 0
+90 195 150 0
+105 111 21 0
+193 96 157 0
+23 -10 164 0
+-30 -155 114 0
+-147 -42 143 0
+187 163 -40 0
+58 66 107 0
+106 67 159 0
+-140 -4 60 0
+164 177 86 0
+103 -99 52 0
+-165 176 192 0
+116 -72 58 0
+-68 -170 -122 0
+158 -188 177 0
+194 87 -82 0
+166 189 82 0
+116 -11 -18 0
+-151 132 141 0
+-144 -22 136 0
+2 -6 -32 0
+35 -90 -57 0
+-176 33 -136 0
+40 12 -151 0
+-40 102 117 0
+23 -17 64 0
+184 -39 -51 0
+179 -41 12 0
+-104 -173 -8 0
+111 -163 75 0
+-149 -86 -113 0
+-5 -92 -22 0
+-195 -20 113 0
+-50 71 120 0
+-128 69 120 0
+54 -100 106 0
+97 -163 156 0
+-140 130 -63 0
+178 -151 155 0
+17 -194 16 0
+-31 -106 82 0
+-34 -197 31 0
+-59 -136 157 0
+149 -10 -98 0
+-164 135 -145 0
+60 -94 114 0
+69 75 195 0
+141 -5 -80 0
+118 -15 -165 0
+186 -118 78 0
+4 83 177 0
+10 87 -27 0
+-23 -198 -124 0
+-3 -163 31 0
+-2 -17 198 0
+-67 16 -99 0
+-160 98 -147 0
+56 -85 -54 0
+-94 12 -4 0
+-194 -25 -21 0
+156 130 -35 0
+-112 162 -66 0
+-162 161 -157 0
+6 -56 -23 0
+-5 169 69 0
+106 4 64 0
+-181 -142 46 0
+-41 67 36 0
+-88 -178 99 0
+14 -147 -18 0
+69 -168 -151 0
+76 22 -194 0
+-66 22 162 0
+-3 -164 104 0
+136 102 -123 0
+127 135 -126 0
+117 -85 144 0
+10 -85 196 0
+-134 168 -180 0
+82 -11 31 0
+-176 -180 46 0
+13 60 176 0
+75 -85 103 0
+113 -43 3 0
+106 93 -65 0
+88 40 150 0
+95 -151 -149 0
+1 191 -110 0
+77 45 56 0
+183 -34 126 0
+-82 -52 -185 0
+111 122 -110 0
+20 117 187 0
+181 -41 -50 0
+181 176 -53 0
+129 -58 -63 0
+17 111 44 0
+131 18 138 0
+12 -38 -163 0
+128 124 -44 0
+-23 -119 4 0
+35 -73 -62 0
+8 189 47 0
+-185 -194 76 0
+19 -117 -97 0
+-72 -183 99 0
+-151 -103 -170 0
+-142 175 65 0
+-119 -121 7 0
+-180 165 73 0
+93 -161 -38 0
+132 83 -44 0
+73 -79 -200 0
+151 162 -97 0
+-20 -57 196 0
+100 140 143 0
+-38 -39 -182 0
+-172 -162 44 0
+-151 49 -58 0
+-27 -191 46 0
+150 -68 -101 0
+181 -36 126 0
+37 -94 184 0
+-113 169 17 0
+-109 -93 -63 0
+-98 86 171 0
+155 -43 48 0
+77 141 -76 0
+-93 66 52 0
+-162 -143 -91 0
+-142 -146 -194 0
+175 -5 95 0
+-55 198 34 0
+-149 -38 182 0
+-83 68 -157 0
+-169 34 133 0
+140 186 152 0
+13 -30 -199 0
+86 -15 187 0
+87 -121 -144 0
+192 77 -140 0
+-86 94 12 0
+-154 124 80 0
+-127 138 191 0
+179 -44 165 0
+193 90 66 0
+54 110 46 0
+52 -193 53 0
+64 -66 40 0
+-103 -89 -88 0
+-7 64 142 0
+139 32 6 0
+-103 108 -42 0
+-64 200 -53 0
+-73 -157 119 0
+-152 124 49 0
+-196 30 -54 0
+-67 139 195 0
+-37 197 176 0
+133 -176 99 0
+190 44 -14 0
+-53 -122 62 0
+70 150 85 0
+-169 -20 171 0
+70 -186 132 0
+-80 13 29 0
+13 -71 199 0
+-140 45 -173 0
+56 49 21 0
+137 -85 188 0
+-123 -165 140 0
+-125 2 -152 0
+-175 -43 176 0
+-135 95 -19 0
+190 178 40 0
+195 54 -116 0
+63 -29 -19 0
+-184 122 -20 0
+3 12 198 0
+170 -123 63 0
+169 -34 -154 0
+166 -183 25 0
+-9 -35 -90 0
+1 99 -5 0
+-20 49 -10 0
+-91 -88 -63 0
+-154 -25 63 0
+132 134 -71 0
+103 41 9 0
+-170 -43 117 0
+146 -188 99 0
+166 -144 -85 0
+-129 123 -60 0
+-84 185 31 0
+-42 -104 -174 0
+-70 45 -183 0
+189 168 47 0
+-180 102 -33 0
+-115 -159 154 0
+159 -68 -148 0
+144 -24 22 0
+-106 -87 -19 0
+44 62 171 0
+-180 40 -133 0
+-88 140 19 0
+162 71 63 0
+-176 -180 -14 0
+136 -88 -70 0
+-16 89 79 0
+-48 -168 142 0
+-169 181 -100 0
+129 -2 16 0
+87 33 22 0
+138 192 45 0
+43 -149 169 0
+-2 -68 -52 0
+-40 -47 162 0
+41 -184 -179 0
+38 184 -26 0
+-167 -141 -164 0
+-53 -192 -98 0
+171 184 -30 0
+-101 -15 -56 0
+-10 -176 -136 0
+-25 80 -1 0
+-55 182 89 0
+-99 -50 163 0
+109 78 105 0
+111 142 137 0
+63 160 -140 0
+-95 -37 77 0
+-149 138 159 0
+-25 133 -106 0
+-154 -98 -61 0
+116 -48 -10 0
+-106 -47 64 0
+113 -60 -57 0
+161 63 105 0
+-9 162 117 0
+-11 52 45 0
+-133 -128 -2 0
+-128 177 66 0
+-30 129 -126 0
+116 -38 -16 0
+34 104 -13 0
+-7 -97 32 0
+-111 -133 -99 0
+109 176 -29 0
+170 -34 -25 0
+-132 5 54 0
+183 -39 -104 0
+110 155 -190 0
+-12 71 103 0
+-198 186 75 0
+-5 -70 54 0
+9 185 -76 0
+186 16 78 0
+-47 27 175 0
+-113 -26 -102 0
+-37 183 54 0
+71 -192 -8 0
+88 -21 30 0
+77 83 153 0
+161 -52 -28 0
+-104 -116 -25 0
+165 95 23 0
+-7 54 -17 0
+32 146 64 0
+116 92 77 0
+200 87 199 0
+179 118 69 0
+101 -7 45 0
+-156 -36 4 0
+99 -145 98 0
+-185 24 88 0
+165 95 130 0
+42 82 -16 0
+-21 -82 191 0
+146 -88 -186 0
+-61 53 -199 0
+174 125 92 0
+150 -126 3 0
+4 91 16 0
+96 -80 122 0
+-74 4 -12 0
+114 -140 -138 0
+92 153 101 0
+163 -157 -143 0
+63 91 -17 0
+-145 -149 137 0
+55 -185 -39 0
+-182 -100 72 0
+11 -125 53 0
+-71 175 -120 0
+-81 -91 195 0
+58 -95 63 0
+2 -86 96 0
+128 37 -109 0
+-160 70 -142 0
+152 -102 -199 0
+100 74 63 0
+-17 -66 119 0
+-51 48 -69 0
+66 -118 -98 0
+171 83 152 0
+131 47 32 0
+-149 -18 79 0
+85 -98 -147 0
+-47 3 40 0
+113 179 -53 0
+-192 -119 139 0
+22 113 143 0
+46 101 195 0
+73 -12 72 0
+83 -169 195 0
+-156 128 5 0
+-117 27 -104 0
+-194 89 -3 0
+-117 -96 49 0
+-199 -175 -13 0
+-33 -53 189 0
+-47 35 -122 0
+6 -93 181 0
+127 -105 163 0
+-110 -180 -94 0
+-45 -157 187 0
+-138 -22 139 0
+99 63 71 0
+-97 81 -102 0
+-133 55 147 0
+133 -128 -72 0
+124 -13 168 0
+60 46 -109 0
+-53 179 -1 0
+-97 -132 76 0
+100 -65 88 0
+-80 -183 35 0
+-137 -169 -185 0
+-173 78 130 0
+46 98 -169 0
+-187 71 24 0
+56 -148 -199 0
+-40 -118 186 0
+-160 -113 -87 0
+43 151 -89 0
+-149 31 50 0
+-140 43 94 0
+198 7 150 0
+18 50 -152 0
+-50 -192 168 0
+-56 -91 19 0
+38 -148 -54 0
+157 -41 -70 0
+-103 99 33 0
+39 50 149 0
+116 -193 169 0
+158 -197 22 0
+120 -160 34 0
+45 166 -94 0
+101 15 74 0
+-194 -33 153 0
+70 -122 -189 0
+112 -167 -82 0
+-42 -70 67 0
+-188 -25 159 0
+162 -156 -139 0
+179 -85 107 0
+-130 -164 4 0
+59 -91 -194 0
+102 71 39 0
+98 -122 125 0
+-78 165 36 0
+144 -152 194 0
+106 -174 -194 0
+5 190 30 0
+-10 147 102 0
+-77 -23 128 0
+123 45 166 0
+41 -73 59 0
+15 -81 -33 0
+-191 121 71 0
+-62 -168 -187 0
+-194 -180 75 0
+98 12 107 0
+-65 132 47 0
+4 -135 54 0
+-141 -43 -96 0
+132 6 103 0
+110 36 43 0
+-63 -1 -122 0
+39 -105 184 0
+-83 11 131 0
+-115 -174 146 0
+75 -33 25 0
+89 -17 -66 0
+111 -86 -171 0
+-124 -95 148 0
+-147 36 -194 0
+50 -22 -42 0
+47 -154 76 0
+-130 168 -109 0
+-115 -154 27 0
+31 131 -58 0
+172 -51 74 0
+52 -26 -106 0
+-184 85 110 0
+-44 -28 -68 0
+136 96 -196 0
+-192 69 -156 0
+-37 -198 -48 0
+21 -94 145 0
+172 71 64 0
+115 9 178 0
+95 -91 -54 0
+-111 -132 -156 0
+98 -38 -154 0
+-90 -62 84 0
+171 -129 -172 0
+-63 92 116 0
+-161 192 -180 0
+5 94 -129 0
+19 5 -44 0
+71 51 35 0
+-187 9 107 0
+-51 127 115 0
+150 -65 -111 0
+179 -66 28 0
+112 -125 -176 0
+162 73 46 0
+-29 98 -158 0
+193 59 6 0
+110 24 -52 0
+-54 -80 -85 0
+-196 -148 -52 0
+40 15 -153 0
+66 161 -153 0
+-41 175 -4 0
+-28 -101 133 0
+110 149 184 0
+23 179 -137 0
+-80 -166 67 0
+-117 -160 66 0
+121 -159 -65 0
+-26 112 -161 0
+4 108 159 0
+91 13 -43 0
+-1 42 -68 0
+179 71 -168 0
+126 -158 15 0
+-174 143 -98 0
+-192 112 81 0
+150 63 174 0
+81 128 146 0
+-2 123 -109 0
+94 165 -138 0
+-119 -113 -74 0
+-41 -35 173 0
+199 -42 122 0
+55 12 -36 0
+-13 75 -61 0
+190 -100 3 0
+-132 12 -145 0
+-166 90 -82 0
+-119 153 189 0
+131 62 -142 0
+-175 190 -165 0
+-70 -31 -2 0
+-127 -135 140 0
+-42 171 -156 0
+-143 -130 -105 0
+-136 164 -111 0
+-122 -199 86 0
+-163 -129 35 0
+-11 87 184 0
+149 -71 16 0
+-170 -65 -162 0
+-84 180 130 0
+-12 -83 -179 0
+-173 -158 1 0
+24 32 179 0
+-4 77 -129 0
+-62 129 63 0
+84 -161 14 0
+-181 -157 163 0
+-167 -72 132 0
+165 -19 -180 0
+-46 90 -179 0
+-184 29 34 0
+71 111 -141 0
+100 -114 133 0
+-31 81 -145 0
+144 121 128 0
+30 17 -132 0
+108 -160 -48 0
+-137 -2 -142 0
+-48 -132 37 0
+107 78 -17 0
+-113 -96 71 0
+32 23 -132 0
+187 54 -102 0
+-90 -103 189 0
+164 -130 -71 0
+-113 -106 -28 0
+33 93 15 0
+-121 -169 141 0
+-141 -197 -54 0
+21 -81 -153 0
+-85 -95 -90 0
+-87 55 -52 0
+-108 -196 -171 0
+86 198 78 0
+-158 197 -135 0
+-49 -128 69 0
+-148 -155 189 0
+-49 78 -139 0
+-155 178 -152 0
+-199 -107 -78 0
+40 60 86 0
+170 40 196 0
+-97 141 -56 0
+46 32 116 0
+-63 99 84 0
+172 -124 168 0
+-133 -99 180 0
+14 59 -31 0
+137 -101 195 0
+-78 75 -189 0
+82 138 112 0
+-129 113 11 0
+58 -130 176 0
+-138 -128 -57 0
+1 -192 28 0
+-78 99 -13 0
+69 65 173 0
+-196 -53 35 0
+48 147 80 0
+76 -61 93 0
+-40 186 70 0
+-77 125 -113 0
+-44 -1 152 0
+143 191 -129 0
+-128 54 -159 0
+91 117 -33 0
+193 4 -54 0
+177 -92 87 0
+-172 -113 -128 0
+58 -191 27 0
+-94 115 19 0
+70 -23 -63 0
+111 -116 53 0
+-77 -60 82 0
+-58 -74 20 0
+143 133 -54 0
+156 29 181 0
+-128 174 95 0
+169 -81 -161 0
+199 8 26 0
+11 -187 -132 0
+-87 -101 56 0
+-67 32 160 0
+119 -28 -61 0
+-51 -57 22 0
+-196 -104 -177 0
+-13 24 52 0
+-119 -3 74 0
+62 84 -148 0
+-152 172 -174 0
+105 35 -93 0
+-187 -151 -129 0
+-37 94 -88 0
+-85 156 116 0
+70 141 198 0
+-145 -115 102 0
+-198 172 -151 0
+182 -103 35 0
+-179 83 170 0
+62 -110 174 0
+171 96 -82 0
+59 73 153 0
+-197 91 -130 0
+14 -143 -83 0
+-21 -76 -121 0
+108 -24 60 0
+11 128 135 0
+-159 -75 157 0
+-24 -136 -86 0
+-10 143 -140 0
+71 98 -174 0
+-18 -14 106 0
+-118 67 -181 0
+-181 149 159 0
+168 -169 90 0
+158 -48 -9 0
+144 176 -113 0
+-20 -197 175 0
+51 90 -49 0
+5 -32 196 0
+-101 -44 187 0
+-200 153 37 0
+92 -94 43 0
+-54 -51 -55 0
+128 160 -131 0
+-157 12 189 0
+-140 -23 -54 0
+-146 -73 110 0
+-106 -197 89 0
+119 -58 -87 0
+-66 38 -136 0
+-23 1 -174 0
+85 87 -19 0
+156 56 -116 0
+-131 -188 -175 0
+-95 -36 73 0
+-85 54 -4 0
+-163 36 198 0
+107 65 -70 0
+-4 -146 -147 0
+-97 -45 111 0
+-66 16 177 0
+-109 -143 190 0
+-17 -81 34 0
+-71 134 -17 0
+-41 -67 87 0
+155 -150 91 0
+61 191 81 0
+104 -23 90 0
+174 36 2 0
+5 -181 -142 0
+-6 -14 95 0
+-108 -35 14 0
+70 156 -56 0
+139 -106 -194 0
+163 89 -124 0
+11 110 -183 0
+63 -91 11 0
+-40 77 114 0
+-70 54 -117 0
+-140 137 -88 0
+-92 157 178 0
+28 54 148 0
+-102 -101 -72 0
+175 -149 -134 0
+81 -28 17 0
+182 155 151 0
+111 7 155 0
+121 22 -120 0
+-40 137 4 0
+98 -198 -65 0
+-41 -29 28 0
+152 -96 -55 0
+-62 19 149 0
+133 -91 84 0
+-118 -147 72 0
+-135 -11 -156 0
+168 -36 -30 0
+199 167 104 0
+-136 53 168 0
+-92 84 -105 0
+-108 -44 -49 0
+128 99 -16 0
+169 150 -81 0
+-64 -61 -63 0
+-153 -45 -166 0
+-109 -57 29 0
+112 82 -140 0
+190 134 110 0
+-21 145 70 0
+166 37 -188 0
+-61 62 -139 0
+-79 11 89 0
+52 -48 -177 0
+188 -79 -105 0
+-102 71 78 0
+178 -196 61 0
+-108 -167 -1 0
+197 155 110 0
+-108 81 -95 0
+170 -47 -17 0
+20 -72 -77 0
+146 189 -112 0
+84 -69 88 0
+34 -147 190 0
+175 -146 -133 0
+-20 -87 122 0
+112 54 -155 0
+-146 167 76 0
+-168 193 -17 0
+-162 161 157 0
+-178 124 32 0
+93 -18 142 0
+187 161 18 0
+-140 30 -48 0
+151 88 178 0
+-50 -164 -1 0
+80 27 18 0
+-145 -101 -40 0
+-196 -70 23 0
+16 150 -4 0
+-176 -85 70 0
+-155 -157 15 0
+176 138 -21 0
+18 -97 -62 0
+83 141 19 0
+165 163 -164 0
+-44 177 81 0
+186 -146 -40 0
+-124 154 -100 0
+115 -113 -192 0
+-161 -6 -61 0
+142 182 171 0
+-110 167 144 0
+28 -35 178 0
+47 65 40 0
+16 111 165 0
+-104 45 -96 0
+136 -32 -86 0
+-151 149 -74 0
+-49 105 15 0
+2 197 -94 0
+136 -104 69 0
+83 141 -156 0
+-196 -102 189 0
+-58 -1 -192 0
+-74 152 116 0
+-158 126 192 0
+-29 -95 -5 0
+-134 181 164 0
+-81 183 12 0
+156 -140 166 0
+123 5 -62 0
+68 -91 43 0
+74 -100 -25 0
+176 83 -52 0
+113 64 -84 0
+179 183 -113 0
+74 -84 -177 0
+-163 140 -194 0
+"""
+
+output = "SAT"
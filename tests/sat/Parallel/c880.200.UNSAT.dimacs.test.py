@@ -0,0 +1,889 @@
+input = """
+c num blocks = 1
+c num vars = 200
+c minblockids[0] = 1
+c maxblockids[0] = 200
+p cnf 200 880
+144 -165 129 0
+65 122 -140 0
+-139 185 2 0
+-80 101 150 0
+-108 129 -98 0
+-184 -59 -149 0
+119 -187 51 0
+22 139 -39 0
+-58 -149 38 0
+46 179 -189 0
+68 -112 -83 0
+-164 25 173 0
+5 -79 3 0
+-173 76 -110 0
+182 80 57 0
+-190 159 -14 0
+-2 -103 -68 0
+-153 -103 7 0
+-166 89 -1 0
+-119 -18 197 0
+-162 -33 -59 0
+-147 -161 -52 0
+-144 -112 -150 0
+-195 -155 126 0
+-109 -169 -182 0
+-89 173 -19 0
+34 28 -166 0
+-17 -5 188 0
+-55 160 -110 0
+-57 117 143 0
+161 33 157 0
+-69 -95 71 0
+-198 73 -77 0
+21 -132 -33 0
+32 -30 -60 0
+140 -143 106 0
+65 -143 -57 0
+23 30 132 0
+54 172 178 0
+-62 -149 -52 0
+199 -154 135 0
+-189 -91 45 0
+38 139 -198 0
+160 35 188 0
+-111 -30 -7 0
+4 178 -76 0
+128 58 -187 0
+-99 -66 35 0
+147 36 184 0
+-138 -180 8 0
+169 -138 -50 0
+49 96 132 0
+-123 141 41 0
+-196 -71 108 0
+199 -49 46 0
+-114 -38 200 0
+197 -120 155 0
+-75 45 -57 0
+2 -170 -25 0
+-42 -76 18 0
+76 158 -109 0
+36 51 -73 0
+-161 -158 -57 0
+-25 34 105 0
+-146 22 145 0
+101 60 -84 0
+27 68 -57 0
+-56 -32 186 0
+43 46 76 0
+123 34 156 0
+171 54 184 0
+17 119 158 0
+44 3 -59 0
+-90 97 -186 0
+-147 25 -115 0
+-91 183 47 0
+105 104 -67 0
+107 90 194 0
+68 9 -131 0
+-164 -5 -171 0
+171 51 81 0
+-98 121 -200 0
+156 -93 -127 0
+-59 -3 -19 0
+96 -60 197 0
+200 55 179 0
+-173 -134 -161 0
+173 -5 105 0
+-171 43 27 0
+145 193 -26 0
+-178 56 170 0
+46 153 -99 0
+153 -63 178 0
+62 -140 -168 0
+-187 76 105 0
+171 161 -114 0
+60 -90 -48 0
+-168 -162 52 0
+-9 179 -185 0
+-38 -36 -99 0
+-29 -25 172 0
+-194 -160 7 0
+157 -174 4 0
+-121 54 -140 0
+-60 -108 -141 0
+-191 103 -98 0
+139 21 -129 0
+182 147 60 0
+173 197 174 0
+103 168 91 0
+-71 -163 54 0
+130 -115 -57 0
+-150 31 130 0
+6 -199 121 0
+198 -181 79 0
+-1 -186 149 0
+103 -24 -125 0
+-72 -25 22 0
+74 -2 -86 0
+-33 -121 172 0
+-165 -74 162 0
+9 118 16 0
+59 185 -24 0
+136 121 189 0
+-2 24 77 0
+-8 106 -195 0
+-134 102 -45 0
+69 65 -82 0
+68 103 81 0
+112 -100 25 0
+-59 -93 43 0
+183 -126 90 0
+177 27 166 0
+-158 23 -61 0
+-179 -43 112 0
+-47 30 -87 0
+118 -92 24 0
+-128 158 61 0
+-151 33 -92 0
+77 -3 121 0
+-180 -138 197 0
+198 156 17 0
+150 180 86 0
+-181 163 141 0
+-96 -189 26 0
+111 -48 152 0
+-31 108 -149 0
+36 133 174 0
+-5 -153 19 0
+106 -119 -83 0
+-193 -129 121 0
+-121 -108 77 0
+116 200 -184 0
+32 28 173 0
+-120 109 85 0
+138 54 -62 0
+109 -153 58 0
+115 21 58 0
+-108 -67 5 0
+107 -103 178 0
+103 -16 -118 0
+159 -119 -195 0
+92 -148 -155 0
+189 -44 80 0
+180 74 -31 0
+-96 -10 -146 0
+125 147 23 0
+23 46 50 0
+-165 108 29 0
+-179 54 -6 0
+118 50 108 0
+-64 195 -26 0
+70 -139 114 0
+130 88 -76 0
+22 130 -42 0
+59 -2 129 0
+121 -115 54 0
+-48 97 17 0
+-22 152 -134 0
+-142 134 -52 0
+-68 -47 97 0
+111 -37 87 0
+-5 -7 -108 0
+-147 50 158 0
+-45 -118 -36 0
+-59 -129 -185 0
+46 100 -140 0
+-142 123 138 0
+-153 -36 -44 0
+158 -77 -132 0
+149 -107 -178 0
+106 -161 -135 0
+95 185 -12 0
+122 47 137 0
+55 60 133 0
+29 -69 114 0
+18 29 101 0
+181 3 31 0
+-137 -129 -107 0
+29 -189 -82 0
+162 55 -124 0
+-37 107 49 0
+49 -66 -96 0
+-138 104 168 0
+122 24 108 0
+123 -179 -172 0
+171 190 8 0
+30 -7 180 0
+-19 52 -55 0
+-13 -22 30 0
+103 187 -174 0
+124 101 141 0
+-29 5 -103 0
+-135 -20 62 0
+-38 -194 -115 0
+-176 -31 73 0
+-24 -185 -176 0
+67 -50 88 0
+-33 92 43 0
+26 189 49 0
+54 -19 42 0
+190 -181 89 0
+-160 46 81 0
+44 133 130 0
+177 106 -114 0
+-52 -17 16 0
+-26 -8 -46 0
+-151 -76 -159 0
+-197 56 -100 0
+-139 49 142 0
+171 -174 119 0
+-159 106 -100 0
+128 -21 -170 0
+103 19 -182 0
+24 91 59 0
+-85 164 -175 0
+62 -164 4 0
+171 33 8 0
+32 108 67 0
+-120 177 87 0
+67 48 -105 0
+41 -71 120 0
+-130 -152 50 0
+51 87 41 0
+-190 157 -78 0
+-36 147 -53 0
+-16 -182 -127 0
+-43 -10 -142 0
+23 -35 150 0
+181 36 102 0
+120 190 175 0
+79 -196 40 0
+43 -83 20 0
+120 -59 155 0
+84 5 -146 0
+-183 -72 46 0
+69 80 -62 0
+51 183 -187 0
+7 152 -119 0
+-101 -115 108 0
+-33 -104 -63 0
+86 -62 -190 0
+-85 -103 -12 0
+154 -28 -74 0
+-64 -51 100 0
+74 -16 164 0
+-114 187 89 0
+-90 117 -4 0
+-176 -110 -115 0
+-40 76 -173 0
+-122 173 -175 0
+-125 -18 -119 0
+-88 79 86 0
+-92 -196 -32 0
+111 -65 73 0
+170 82 69 0
+140 -175 52 0
+25 -15 -58 0
+-100 170 140 0
+38 138 -74 0
+184 141 104 0
+92 86 180 0
+164 40 79 0
+86 26 87 0
+20 144 -108 0
+86 -71 -149 0
+188 116 98 0
+-20 -157 -42 0
+-195 127 13 0
+-10 -98 -171 0
+50 155 -40 0
+62 -158 -93 0
+-37 80 -81 0
+-185 75 -164 0
+143 153 43 0
+-55 -90 -10 0
+-183 -76 -51 0
+-17 90 149 0
+168 74 64 0
+175 -48 129 0
+48 -174 -99 0
+-98 194 -104 0
+-186 -102 -62 0
+13 -193 -51 0
+40 20 73 0
+-47 41 57 0
+17 -88 102 0
+-154 -169 32 0
+61 149 -7 0
+-61 8 44 0
+-114 -151 15 0
+-101 -196 -147 0
+-108 189 -159 0
+54 127 -112 0
+-175 104 -2 0
+-11 -196 -152 0
+-186 39 18 0
+19 33 -49 0
+-9 182 -180 0
+-137 -21 -36 0
+-62 185 -135 0
+-80 118 -50 0
+-156 187 174 0
+-96 -200 168 0
+71 -152 151 0
+62 -34 40 0
+-53 197 172 0
+69 -111 132 0
+-113 45 172 0
+-134 20 -200 0
+140 18 -114 0
+64 -104 -47 0
+-11 -127 -55 0
+-48 -157 124 0
+199 -65 -151 0
+-83 102 -15 0
+-40 133 88 0
+109 179 63 0
+-1 -77 -111 0
+144 41 153 0
+-188 197 -18 0
+-108 -40 1 0
+-77 -76 -164 0
+1 183 -70 0
+-109 -176 23 0
+200 -104 -170 0
+77 76 -65 0
+-51 3 -98 0
+-9 -130 -39 0
+-164 -71 -105 0
+-53 -113 -16 0
+87 -74 -127 0
+106 139 56 0
+-131 60 61 0
+-186 109 -162 0
+-64 -47 84 0
+-169 112 -99 0
+197 -115 3 0
+122 -96 57 0
+-55 107 152 0
+66 130 -101 0
+76 97 -1 0
+-128 166 34 0
+-62 -97 -68 0
+184 129 -49 0
+174 -31 101 0
+148 111 63 0
+49 14 177 0
+107 -113 -104 0
+-12 -119 132 0
+-186 -48 -56 0
+-62 193 167 0
+121 24 171 0
+-147 -195 165 0
+-33 -64 141 0
+127 -196 75 0
+131 -72 -112 0
+88 -6 -48 0
+-114 -188 180 0
+-37 2 35 0
+127 -180 28 0
+48 147 7 0
+-69 -38 175 0
+-159 -39 66 0
+146 96 -83 0
+-107 150 58 0
+-78 48 -150 0
+-144 -10 -134 0
+140 37 35 0
+-123 55 90 0
+165 194 -133 0
+160 26 -93 0
+186 -60 -181 0
+-31 -122 -160 0
+29 -193 132 0
+132 115 44 0
+-170 97 197 0
+111 154 -15 0
+121 190 177 0
+-75 111 112 0
+32 77 -35 0
+-77 -89 61 0
+83 -188 139 0
+80 -13 -134 0
+-97 -106 -15 0
+163 -159 70 0
+163 -42 117 0
+-196 -48 -143 0
+184 -153 -65 0
+72 -86 21 0
+103 -77 -57 0
+94 -184 98 0
+-36 -198 6 0
+-143 -2 15 0
+173 -23 -39 0
+177 -140 184 0
+-6 110 164 0
+161 100 114 0
+-179 172 -122 0
+48 -39 -30 0
+93 -28 -43 0
+169 178 -101 0
+42 112 126 0
+9 74 48 0
+108 152 -62 0
+58 49 -85 0
+-165 -95 -21 0
+-82 39 -24 0
+30 27 110 0
+-58 69 84 0
+-142 -5 -116 0
+-78 -46 17 0
+-113 21 12 0
+101 147 6 0
+-84 72 -146 0
+-162 -115 -68 0
+25 59 41 0
+65 -44 188 0
+77 59 26 0
+-14 23 139 0
+108 -132 -12 0
+82 -34 -32 0
+-65 194 -85 0
+104 -61 172 0
+197 -178 -190 0
+-82 -38 -76 0
+-59 191 127 0
+188 -172 -67 0
+24 -36 -95 0
+-50 -192 35 0
+-147 78 -159 0
+-15 9 102 0
+-177 -23 180 0
+93 -108 189 0
+-63 164 145 0
+-94 22 -16 0
+-3 -127 49 0
+152 -141 151 0
+-5 -136 155 0
+-141 -82 85 0
+-25 -53 13 0
+-136 -176 28 0
+-42 88 -33 0
+-138 172 -53 0
+-74 -124 61 0
+-111 24 -148 0
+-8 13 -6 0
+95 146 -59 0
+-20 56 -4 0
+-174 70 156 0
+27 -89 -134 0
+-64 170 -35 0
+-80 49 178 0
+-137 -116 -129 0
+-28 -134 -126 0
+-66 -137 -64 0
+4 5 -179 0
+-19 -165 74 0
+-8 -51 -61 0
+3 71 -162 0
+-74 148 -51 0
+193 -114 107 0
+34 -194 -140 0
+155 -173 180 0
+89 -196 39 0
+-75 -6 -35 0
+93 138 5 0
+75 126 -132 0
+138 104 62 0
+-195 183 -170 0
+24 -134 2 0
+-135 119 -161 0
+149 -25 187 0
+-23 -143 -198 0
+-138 86 5 0
+-84 33 -58 0
+119 -124 -116 0
+106 -199 -141 0
+86 -32 177 0
+54 -68 69 0
+-178 -122 168 0
+3 -15 -141 0
+-169 -27 167 0
+46 -16 -137 0
+-54 48 195 0
+72 49 -95 0
+127 -32 29 0
+-15 -114 57 0
+-18 109 75 0
+91 5 200 0
+-86 -59 57 0
+-100 -114 198 0
+-149 -24 187 0
+-166 93 -191 0
+68 -69 -139 0
+-10 -77 -132 0
+108 -135 1 0
+-126 123 186 0
+-123 126 168 0
+97 -140 195 0
+-5 150 3 0
+-178 26 186 0
+-93 -50 -160 0
+-20 -174 42 0
+-4 -65 -63 0
+-16 58 99 0
+-30 -54 31 0
+81 -64 -168 0
+-30 41 -164 0
+52 62 -70 0
+-92 107 1 0
+73 -92 -32 0
+13 61 -129 0
+36 76 -94 0
+160 -87 130 0
+166 28 1 0
+-182 -168 89 0
+-126 77 13 0
+-199 -29 174 0
+103 -56 40 0
+88 -136 145 0
+-94 68 -81 0
+58 160 -17 0
+-139 -119 189 0
+-105 -43 125 0
+135 153 115 0
+32 -98 16 0
+14 30 -114 0
+200 40 -118 0
+131 160 -14 0
+74 -134 -154 0
+-4 169 82 0
+-94 159 -166 0
+115 117 149 0
+-60 152 -28 0
+-192 51 142 0
+162 8 -199 0
+111 127 160 0
+-43 165 104 0
+-57 -89 -112 0
+153 28 -34 0
+108 30 -84 0
+-109 189 -187 0
+-187 51 57 0
+22 192 -122 0
+5 -44 144 0
+-175 -26 -33 0
+-96 -107 195 0
+-126 118 21 0
+-56 -164 -19 0
+40 -27 -8 0
+132 -191 -155 0
+-139 -30 -69 0
+-176 -85 9 0
+-189 152 -184 0
+-67 -34 -108 0
+33 92 -1 0
+1 92 60 0
+160 -174 -170 0
+-64 110 138 0
+23 -1 137 0
+153 -179 82 0
+-40 -129 -36 0
+-140 -84 79 0
+135 179 -199 0
+-78 -175 -35 0
+-31 -49 152 0
+-135 38 165 0
+-92 189 -153 0
+76 84 148 0
+162 101 -166 0
+84 121 -24 0
+68 -84 65 0
+177 163 -56 0
+-1 98 51 0
+68 12 187 0
+-56 116 -60 0
+34 -124 123 0
+-6 65 135 0
+134 -150 110 0
+51 -128 -139 0
+161 198 -49 0
+96 30 171 0
+136 -178 163 0
+41 -162 137 0
+-159 6 -10 0
+-72 -163 71 0
+82 -160 199 0
+-26 -71 -138 0
+84 -186 -40 0
+-65 -200 190 0
+110 -144 -179 0
+-194 157 -172 0
+137 15 -9 0
+75 -174 82 0
+97 50 69 0
+-116 50 136 0
+-25 -50 -135 0
+174 -49 43 0
+-29 136 -45 0
+69 -122 188 0
+-32 9 -187 0
+-109 199 113 0
+-70 106 -39 0
+-185 -174 19 0
+152 188 186 0
+7 -199 82 0
+-193 -142 2 0
+30 -75 15 0
+8 194 160 0
+-159 103 -96 0
+168 60 59 0
+190 110 71 0
+-162 131 22 0
+65 -126 -18 0
+-30 -46 -127 0
+-164 26 -3 0
+5 69 -7 0
+-144 104 -113 0
+-98 35 142 0
+178 135 -2 0
+200 2 117 0
+58 91 86 0
+-120 -3 119 0
+170 -162 188 0
+-64 14 -158 0
+-66 -77 25 0
+176 -89 103 0
+69 79 -23 0
+-96 109 -80 0
+154 148 140 0
+102 -7 116 0
+47 141 155 0
+-147 86 -159 0
+23 -171 104 0
+-115 -72 -12 0
+49 144 96 0
+200 129 95 0
+53 -39 -135 0
+-64 128 113 0
+-77 -169 158 0
+-37 51 -76 0
+-139 -168 186 0
+92 77 79 0
+-99 -28 -102 0
+-72 -193 123 0
+-155 -34 -38 0
+172 -188 -152 0
+148 -156 64 0
+-163 -36 -189 0
+-5 -124 41 0
+196 -25 -141 0
+-124 -139 23 0
+-113 11 172 0
+12 -22 200 0
+-129 -174 178 0
+-58 -5 28 0
+-139 -13 -88 0
+-42 -154 151 0
+155 56 -41 0
+-92 -16 160 0
+54 13 -170 0
+89 -98 -50 0
+-130 126 123 0
+56 191 -43 0
+20 132 112 0
+148 -34 -142 0
+-162 -140 -18 0
+-19 189 192 0
+-133 154 -155 0
+45 -108 -126 0
+-16 10 -116 0
+16 -190 -31 0
+77 167 85 0
+-108 84 120 0
+-56 -90 130 0
+-114 -183 129 0
+-90 15 -123 0
+87 -78 52 0
+139 29 121 0
+22 -144 181 0
+105 -194 -41 0
+-3 -81 14 0
+-109 -72 -180 0
+-127 -197 -13 0
+152 112 -101 0
+-60 126 -75 0
+-51 41 180 0
+94 -36 -170 0
+163 -33 -7 0
+-6 -71 -109 0
+-105 32 -35 0
+190 163 -171 0
+-12 -103 -67 0
+92 58 -119 0
+-180 -92 84 0
+145 93 -135 0
+-159 138 -86 0
+-127 175 -154 0
+64 17 80 0
+84 -54 -116 0
+64 164 122 0
+182 -47 39 0
+65 104 -71 0
+57 -154 -5 0
+108 85 -64 0
+33 -13 49 0
+16 178 159 0
+155 60 -67 0
+46 -66 -50 0
+-75 -189 -164 0
+-75 -183 -165 0
+42 44 162 0
+-65 -15 -69 0
+-195 -14 198 0
+-85 24 19 0
+-26 -69 28 0
+184 188 113 0
+-72 160 42 0
+140 -159 -11 0
+-76 -163 -31 0
+-55 179 173 0
+118 -120 110 0
+-178 25 -26 0
+-69 39 85 0
+-52 -143 105 0
+-49 24 99 0
+65 183 95 0
+-145 -20 185 0
+130 43 113 0
+-100 184 194 0
+-84 140 -21 0
+171 -18 -24 0
+-17 121 90 0
+29 5 99 0
+8 146 -51 0
+-133 -182 138 0
+-88 -19 -91 0
+-24 118 87 0
+-135 133 -147 0
+-106 -158 -26 0
+101 -122 -170 0
+-187 -66 -56 0
+122 -24 -92 0
+-132 30 114 0
+105 86 140 0
+-172 83 -32 0
+154 -84 -184 0
+87 -82 -150 0
+4 -173 126 0
+101 47 197 0
+190 28 -163 0
+-110 -154 60 0
+-39 -144 -93 0
+148 29 -89 0
+-131 -34 91 0
+-110 51 135 0
+-2 -93 192 0
+34 -103 -170 0
+-13 48 171 0
+63 -141 -134 0
+-63 130 182 0
+-137 -86 -143 0
+-129 82 46 0
+124 63 -22 0
+-45 -111 -167 0
+153 -146 13 0
+-193 -10 -165 0
+164 -105 -187 0
+55 -13 17 0
+-138 193 -17 0
+99 -74 -112 0
+-154 96 86 0
+-47 27 -28 0
+-57 -19 144 0
+-167 -34 -113 0
+-3 -83 119 0
+-31 -38 159 0
+43 105 32 0
+183 85 4 0
+-15 -93 -27 0
+-125 58 44 0
+109 -28 126 0
+-34 141 2 0
+-18 177 -168 0
+-136 -166 167 0
+179 19 -75 0
+-80 174 117 0
+55 123 171 0
+-39 -175 -183 0
+13 3 128 0
+-63 138 -23 0
+-17 -35 173 0
+-172 170 -2 0
+182 94 -36 0
+199 -17 120 0
+9 180 70 0
+-85 114 -4 0
+-100 113 -65 0
+-15 -117 -18 0
+177 -99 -175 0
+-133 -52 165 0
+58 27 -150 0
+-63 47 -11 0
+-82 -23 114 0
+2 -98 -62 0
+-180 193 -190 0
+-38 -186 76 0
+30 -196 -20 0
+23 -20 90 0
+-192 -29 -179 0
+-76 57 170 0
+-7 37 152 0
+-69 -149 -4 0
+92 98 81 0
+109 -93 77 0
+21 -128 22 0
+-99 -165 108 0
+111 64 58 0
+-116 -72 167 0
+148 -102 95 0
+-11 -30 74 0
+164 98 -63 0
+88 -152 110 0
+-166 43 147 0
+199 -88 3 0
+-47 58 96 0
+109 -137 -61 0
+148 126 52 0
+152 151 -176 0
+51 -104 64 0
+26 36 -83 0
+-188 -145 85 0
+-64 134 19 0
+21 67 -188 0
+159 26 67 0
+-130 44 -179 0
+-23 -143 172 0
+-6 -180 -13 0
+155 -6 -90 0
+160 84 -149 0
+-164 175 -14 0
+37 89 -133 0
+-187 105 -168 0
+27 160 192 0
+43 86 194 0
+25 130 -175 0
+119 20 -171 0
+56 51 -5 0
+-46 156 -134 0
+46 -176 79 0
+156 122 -72 0
+146 164 179 0
+68 83 130 0
+9 -56 62 0
+82 -88 -186 0
+-174 -5 -103 0
+-190 -71 -112 0
+137 80 4 0
+-7 -185 57 0
+"""
+
+output = "UNSAT"
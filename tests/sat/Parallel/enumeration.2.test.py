@@ -0,0 +1,40 @@
+input = """
+p cnf 14 30
+14 -1 2 0
+-12 -13 11 0
+10 -1 -14 0
+-13 -12 -9 0
+-1 -14 -6 0
+7 9 3 0
+1 3 -6 0
+9 -11 -14 0
+-12 -9 -6 0
+-3 13 -7 0
+-5 -8 -9 0
+-6 -10 12 0
+-6 -12 -3 0
+-5 -13 12 0
+8 -9 6 0
+14 4 12 0
+5 10 -4 0
+-4 14 1 0
+6 14 3 0
+2 14 -1 0
+5 3 -13 0
+10 1 4 0
+6 -10 -11 0
+-8 1 -5 0
+13 -7 10 0
+-2 11 13 0
+-8 -13 -3 0
+-3 -6 5 0
+12 -9 3 0
+3 -14 13 0
+"""
+
+flags = "-n=0"
+
+output = """
+sat
+models 98
+"""
@@ -0,0 +1,80 @@
+input = """
+p cnf 22 70
+7 1 17 0
+1 -2 22 0
+-4 -11 -15 0
+9 -12 -8 0
+-8 10 -17 0
+-14 -16 -3 0
+-19 -11 21 0
+16 1 7 0
+10 17 16 0
+-13 -2 -3 0
+-17 8 6 0
+-10 -6 -21 0
+-11 -15 3 0
+-4 -22 16 0
+9 3 -10 0
+-2 -9 -6 0
+2 -17 16 0
+19 15 9 0
+-11 -21 13 0
+-20 10 -15 0
+-13 -1 22 0
+-5 -9 -8 0
+-8 -22 -19 0
+1 -20 12 0
+6 -21 -17 0
+-5 -11 -4 0
+20 -18 16 0
+-4 5 21 0
+-19 -18 -20 0
+8 -18 21 0
+-22 11 -15 0
+-11 5 9 0
+15 19 -7 0
+-7 22 3 0
+11 -6 -20 0
+-8 14 6 0
+16 -15 20 0
+14 9 -15 0
+11 13 21 0
+-20 22 -15 0
+-15 -20 -9 0
+13 21 -17 0
+-15 16 11 0
+-8 6 -18 0
+-22 11 -15 0
+14 -4 10 0
+19 -9 10 0
+5 16 17 0
+-13 -14 -8 0
+-21 22 -13 0
+-13 -12 -11 0
+4 5 16 0
+-6 17 10 0
+16 -9 -6 0
+6 -17 21 0
+20 2 9 0
+-12 -13 -11 0
+-12 14 -21 0
+-19 21 8 0
+14 5 4 0
+-21 -13 20 0
+7 18 12 0
+12 -17 9 0
+-5 -1 19 0
+-5 22 6 0
+-14 11 21 0
+-18 -6 13 0
+9 5 -17 0
+-15 5 -13 0
+-8 -22 2 0
+"""
+
+flags = "-n=0"
+
+output = """
+sat
+models 1069
+"""
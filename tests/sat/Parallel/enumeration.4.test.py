@@ -0,0 +1,58 @@
+input = """
+p cnf 16 48
+5 -10 14 0
+-16 -13 8 0
+-4 -8 1 0
+15 5 -12 0
+1 -16 15 0
+14 -12 -1 0
+8 -6 -4 0
+1 7 -14 0
+-4 12 -6 0
+-10 16 -8 0
+-8 -12 13 0
+-12 9 -16 0
+-4 -13 -3 0
+-1 -8 16 0
+6 9 4 0
+-13 -9 -6 0
+1 7 -13 0
+-2 8 -14 0
+-16 -14 6 0
+11 8 10 0
+-6 14 2 0
+-3 14 -1 0
+8 -5 -2 0
+-3 16 -15 0
+-10 -8 -12 0
+-4 -1 -5 0
+-7 5 -2 0
+-1 4 16 0
+-6 8 -12 0
+8 -9 -11 0
+-14 1 12 0
+2 -5 -16 0
+-6 7 10 0
+2 -10 14 0
+-2 7 4 0
+-14 10 -4 0
+10 -9 -8 0
+10 -1 3 0
+-11 7 -4 0
+-12 15 14 0
+2 16 3 0
+-9 -13 -6 0
+11 -2 5 0
+-4 6 -1 0
+-5 14 -3 0
+3 10 -9 0
+12 -15 -5 0
+-4 13 1 0
+"""
+
+flags = "-n=10"
+
+output = """
+sat
+models 10
+"""
@@ -0,0 +1,15 @@
+input = """
+p cnf 4 5
+3 4 0
+-3 -2 0
+-1 2 0
+1 2 0
+-4 -2 0
+"""
+
+flags = "-n=0"
+
+output = """
+unsat
+models 0
+"""
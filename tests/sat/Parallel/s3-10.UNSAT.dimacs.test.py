@@ -0,0 +1,22 @@
+input = """
+p cnf 4 14
+-4 2 1 0
+-2 -3 4 0
+1 -2 -4 0
+-2 3 -4 0
+1 2 3 0
+1 2 -3 0
+1 -2 3 0
+1 -2 -3 0
+-1 2 3 0
+-1 2 -3 0
+-1 -2 3 0
+-1 -2 -3 0
+1 2 4 0
+-2 3 4 0
+"""
+
+output = """
+unsat
+core 2 -1
+"""
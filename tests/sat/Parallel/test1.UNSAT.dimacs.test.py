@@ -0,0 +1,23 @@
+input = """
+c Programma riscritto in nogood 0
+p cnf 6 14
+1 2 0
+-1 -2 0
+3 2 0
+-3 -2 0
+4 2 0
+-4 -2 0
+6 -3 -4 0
+-6 3 0
+-6 4 0
+5 -3 0
+5 -4 0
+-5 6 0
+-1 2 0
+3 4 0
+"""
+
+output = """
+unsat
+core -2
+"""